@@ -17,12 +17,19 @@
  */
 
 #include "libalee/alee.hpp"
+#ifdef ALEE_GUARD_PAGES
+#include "guardstack.hpp"
+#endif // ALEE_GUARD_PAGES
+#include "blockfile.hpp"
+#include "fileaccess.hpp"
 #include "memdict.hpp"
+#include "tracer.hpp"
 
 #include <charconv>
 #include <fstream>
 #include <iostream>
-#include <vector>
+#include <string>
+#include <string_view>
 
 #ifdef ALEE_MSP430
 #include "lzss.h"
@@ -32,32 +39,76 @@ static Error findword(State&, Word);
 #endif // ALEE_MSP430
 
 static bool okay = false;
+static std::string output; // Collects output until the next flush().
+static BlockFile blocks;
+static Tracer tracer;
 
 static void readchar(State&);
+static void writechars(State&, const char *, std::size_t);
+static void flush(State&);
 static void parseLine(State&, const std::string&);
-static void parseFile(State&, std::istream&);
+static void printError(State&, Error, std::string_view);
+
+static FileAccess files (printError);
 
 int main(int argc, char *argv[])
 {
     MemDict dict;
-    State state (dict, readchar);
+#ifdef ALEE_FLOAT
+    static Float fstack[FloatStackSize];
+#endif // ALEE_FLOAT
+#ifdef ALEE_GUARD_PAGES
+    GuardedStacks stacks;
+    if (!stacks.good()) {
+        std::cerr << "failed to map stacks" << std::endl;
+        return 1;
+    }
+
+    State state (dict, readchar, writechars,
+                 stacks.data(), stacks.size(), stacks.rdata(), stacks.rsize()
+#ifdef ALEE_FLOAT
+                 , fstack, FloatStackSize
+#endif // ALEE_FLOAT
+                 );
+    stacks.attach(state);
+#else
+    static Cell dstack[DataStackSize];
+    static Cell rstack[ReturnStackSize];
+#ifdef ALEE_FLOAT
+    State state (dict, readchar, writechars, dstack, rstack, fstack);
+#else
+    State state (dict, readchar, writechars, dstack, rstack);
+#endif // ALEE_FLOAT
+#endif // ALEE_GUARD_PAGES
 #ifdef ALEE_MSP430
     Parser::customParse = findword;
 #endif // ALEE_MSP430
 
     dict.initialize();
 
-    {
-        std::vector args (argv + 1, argv + argc);
-        for (const auto& a : args) {
-            std::ifstream file (a);
-            parseFile(state, file);
+    for (int i = 1; i < argc; ++i) {
+        if (auto r = files.include(state, argv[i]); r == Error::exit) {
+            flush(state);
+            return 0;
+        } else if (r == Error::file) {
+            printError(state, r, argv[i]);
         }
     }
 
     okay = true;
-    parseFile(state, std::cin);
+    while (std::cin.good()) {
+        flush(state);
 
+        std::string line;
+        std::getline(std::cin, line);
+
+        if (line == "bye")
+            break;
+
+        parseLine(state, line);
+    }
+
+    flush(state);
     return 0;
 }
 
@@ -66,10 +117,13 @@ static void readchar(State& state)
     auto idx = state.dict.read(Dictionary::Input);
     auto addr = static_cast<Addr>(Dictionary::Input + sizeof(Cell) + idx);
 
+    flush(state);
+
     auto c = static_cast<char>(std::cin.get());
     if (isupper(c))
         c += 32;
     state.dict.writebyte(addr, c ? c : ' ');
+    state.dict.writebyte(addr + 1, '\0');
 }
 
 static void save(State& state)
@@ -94,17 +148,17 @@ void user_sys(State& state)
 {
     char buf[32] = {0};
 
-    switch (state.pop()) {
+    switch (const auto sys = state.pop(); sys) {
     case 0: // .
-        std::to_chars(buf, buf + sizeof(buf), state.pop(),
-                      state.dict.read(Dictionary::Base));
-        std::cout << buf << ' ';
+        {
+        auto end = std::to_chars(buf, buf + sizeof(buf), state.pop(),
+                                 state.dict.read(Dictionary::Base)).ptr;
+        *end++ = ' ';
+        state.output({buf, end});
+        }
         break;
     case 1: // unused
-        state.push(static_cast<Addr>(state.dict.capacity() - state.dict.here()));
-        break;
-    case 2: // emit
-        std::cout << static_cast<char>(state.pop());
+        state.push(static_cast<Cell>(state.dict.heapBottom() - state.dict.here()));
         break;
     case 3: // save
         save(state);
@@ -112,54 +166,106 @@ void user_sys(State& state)
     case 4: // load
         load(state);
         break;
+    case 5: // trace
+        tracer.enable(state, state.pop() != 0);
+        break;
+    case 6: // .trace
+        tracer.dump(state);
+        break;
+    case 20: // block
+    case 21: // buffer
+        {
+        const bool fetch = sys == 20;
+        const auto u = static_cast<Addr>(state.pop());
+        const auto addr = blocks.block(state.dict, u, fetch);
+        state.verify(addr != 0, Error::block);
+        state.push(static_cast<Cell>(addr));
+        }
+        break;
+    case 22: // update
+        blocks.update();
+        break;
+    case 23: // save-buffers
+        state.verify(blocks.save(state.dict), Error::block);
+        break;
+    case 24: // empty-buffers
+        blocks.empty();
+        break;
     default:
+        files.sys(state, sys);
         break;
     }
 }
 
+void writechars(State&, const char *str, std::size_t len)
+{
+    output.append(str, len);
+}
+
+void flush(State& state)
+{
+    state.flush();
+    std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+    std::cout.flush();
+    output.clear();
+}
+
 void parseLine(State& state, const std::string& line)
 {
-    if (auto r = Parser::parse(state, line.c_str()); r == Error::none) {
+    if (auto r = Parser::parse(state, line); r == Error::none) {
         if (okay)
-            std::cout << (state.compiling() ? " compiled" : " ok") << std::endl;
+            state.output(state.compiling() ? " compiled\n" : " ok\n");
     } else {
-        switch (r) {
-        case Error::noword:
-            std::cout << "word not found in: " << line << std::endl;
-            break;
-        case Error::push:
-            std::cout << "stack overflow" << std::endl;
-            break;
-        case Error::pushr:
-            std::cout << "return stack overflow" << std::endl;
-            break;
-        case Error::popr:
-            std::cout << "return stack underflow" << std::endl;
-            break;
-        case Error::pop:
-        case Error::top:
-        case Error::pick:
-            std::cout << "stack underflow" << std::endl;
-            break;
-        default:
-            std::cout << "unknown error" << std::endl;
-            break;
-        }
-
+        printError(state, r, line);
         state.reset();
     }
 }
 
-void parseFile(State& state, std::istream& file)
+void printError(State& state, Error r, std::string_view line)
 {
-    while (file.good()) {
-        std::string line;
-        std::getline(file, line);
+    if (tracer.active())
+        tracer.dump(state);
 
-        if (line == "bye")
-            exit(0);
-
-        parseLine(state, line);
+    switch (r) {
+    case Error::noword:
+        state.output("word not found in: ");
+        state.output(line);
+        state.output("\n");
+        break;
+    case Error::push:
+        state.output("stack overflow\n");
+        break;
+    case Error::pushr:
+        state.output("return stack overflow\n");
+        break;
+    case Error::popr:
+        state.output("return stack underflow\n");
+        break;
+    case Error::pop:
+    case Error::top:
+    case Error::pick:
+        state.output("stack underflow\n");
+        break;
+    case Error::fpush:
+        state.output("float stack overflow\n");
+        break;
+    case Error::fpop:
+        state.output("float stack underflow\n");
+        break;
+    case Error::input:
+        state.output("input line too long\n");
+        break;
+    case Error::block:
+        state.output("block i/o error\n");
+        break;
+    case Error::file:
+        state.output("file not found: ");
+        state.output(line);
+        state.output("\n");
+        break;
+    default:
+        state.output("unknown error\n");
+        break;
     }
 }
 
@@ -207,4 +313,3 @@ Error findword(State& state, Word word)
     }
 }
 #endif // ALEE_MSP430
-
@@ -0,0 +1,231 @@
+//
+/// @file blockfile.hpp
+/// @brief Block word-set storage for POSIX hosts.
+//
+// Alee Forth: A portable and concise Forth implementation in modern C++.
+// Copyright (C) 2023  Clyne Sullivan <clyne@bitgloo.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ALEEFORTH_BLOCKFILE_HPP
+#define ALEEFORTH_BLOCKFILE_HPP
+
+#include "libalee/alee.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @class BlockFile
+ * Stores Forth blocks in a memory-mapped file. Blocks are accessed through a
+ * few buffers that are allocated in the dictionary and reused least recently
+ * used first. Updated buffers are written back into the mapping when they
+ * are reused or saved.
+ */
+class BlockFile
+{
+public:
+    /** Size of a block in bytes. */
+    constexpr static Addr BlockSize = 1024;
+
+    /** Number of block buffers. */
+    constexpr static unsigned BufferCount = 3;
+
+    /**
+     * Prepares to use the given file, which is opened on first use.
+     * @param p Path of the block file
+     */
+    explicit BlockFile(const char *p = "alee.blk"):
+        path(p) {}
+
+    ~BlockFile() {
+        if (map != nullptr)
+            munmap(map, mapsize);
+        if (fd >= 0)
+            close(fd);
+    }
+
+    BlockFile(const BlockFile&) = delete;
+    BlockFile& operator=(const BlockFile&) = delete;
+
+    /**
+     * Assigns a buffer to the given block, making it the current block.
+     * @param dict The dictionary that holds the buffers
+     * @param u The block number
+     * @param fetch If true, fill the buffer with the block's contents
+     * @return The buffer's address or zero if no buffer could be assigned,
+     *         which callers must report as an error.
+     */
+    Addr block(Dictionary& dict, Addr u, bool fetch) {
+        for (auto& b : buffers) {
+            if (b.assigned && b.block == u) {
+                b.stamp = ++clock;
+                current = &b;
+                return b.addr;
+            }
+        }
+
+        if (base == 0) {
+            base = dict.allocate(BufferCount * BlockSize);
+            if (base == 0)
+                return 0;
+
+            for (unsigned i = 0; i < BufferCount; ++i)
+                buffers[i].addr = static_cast<Addr>(base + i * BlockSize);
+        }
+
+        auto& b = *std::min_element(buffers, buffers + BufferCount,
+            [](const auto& x, const auto& y) { return x.stamp < y.stamp; });
+        if (b.dirty && !writeback(dict, b))
+            return 0;
+
+        if (fetch) {
+            if (!reserve(0))
+                return 0;
+
+            const auto dst = dict.contiguous(b.addr, BlockSize);
+            const auto src = offset(u) + BlockSize <= mapsize ?
+                map + offset(u) : nullptr;
+
+            if (dst && src) {
+                std::copy(src, src + BlockSize, dst);
+            } else {
+                // Blocks past the end of the file read as blank.
+                for (Addr i = 0; i < BlockSize; ++i) {
+                    dict.writebyte(static_cast<Addr>(b.addr + i),
+                        src ? src[i] : ' ');
+                }
+            }
+        }
+
+        b.block = u;
+        b.assigned = true;
+        b.dirty = false;
+        b.stamp = ++clock;
+        current = &b;
+        return b.addr;
+    }
+
+    /** Marks the current block's buffer as modified. */
+    void update() noexcept {
+        if (current != nullptr)
+            current->dirty = true;
+    }
+
+    /**
+     * Writes all modified buffers to the file.
+     * @return False if the file could not be written.
+     */
+    bool save(Dictionary& dict) {
+        bool ok = true;
+
+        for (auto& b : buffers) {
+            if (b.dirty)
+                ok = writeback(dict, b) && ok;
+        }
+
+        if (map != nullptr)
+            msync(map, mapsize, MS_SYNC);
+
+        return ok;
+    }
+
+    /** Unassigns all buffers, discarding any modifications. */
+    void empty() noexcept {
+        for (auto& b : buffers) {
+            b.assigned = false;
+            b.dirty = false;
+            b.stamp = 0;
+        }
+
+        current = nullptr;
+    }
+
+private:
+    /** A dictionary-resident block buffer. */
+    struct Buffer {
+        Addr addr = 0; /** Address of the buffer's memory */
+        Addr block = 0; /** Block number assigned to the buffer */
+        bool assigned = false; /** True if block is valid */
+        bool dirty = false; /** True if the buffer has been updated */
+        unsigned long int stamp = 0; /** Time of the latest use */
+    };
+
+    const char *path;
+    int fd = -1;
+    uint8_t *map = nullptr;
+    std::size_t mapsize = 0;
+
+    Buffer buffers[BufferCount];
+    Buffer *current = nullptr;
+    Addr base = 0;
+    unsigned long int clock = 0;
+
+    static std::size_t offset(Addr u) noexcept {
+        return static_cast<std::size_t>(u) * BlockSize;
+    }
+
+    /** Opens or grows the file so that it is at least size bytes long. */
+    bool reserve(std::size_t size) {
+        if (fd < 0) {
+            fd = open(path, O_RDWR | O_CREAT, 0644);
+            if (fd < 0)
+                return false;
+
+            struct stat st;
+            if (fstat(fd, &st) == 0 && st.st_size > 0)
+                remap(static_cast<std::size_t>(st.st_size));
+        }
+
+        if (size <= mapsize)
+            return true;
+
+        return ftruncate(fd, static_cast<off_t>(size)) == 0 && remap(size);
+    }
+
+    bool remap(std::size_t size) {
+        if (map != nullptr)
+            munmap(map, mapsize);
+
+        void *m = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        map = m != MAP_FAILED ? static_cast<uint8_t *>(m) : nullptr;
+        mapsize = map != nullptr ? size : 0;
+        return map != nullptr;
+    }
+
+    bool writeback(Dictionary& dict, Buffer& b) {
+        if (!reserve(offset(b.block) + BlockSize))
+            return false;
+
+        const auto dst = map + offset(b.block);
+        if (const auto src = dict.contiguous(b.addr, BlockSize); src) {
+            std::copy(src, src + BlockSize, dst);
+        } else {
+            for (Addr i = 0; i < BlockSize; ++i)
+                dst[i] = dict.readbyte(static_cast<Addr>(b.addr + i));
+        }
+
+        b.dirty = false;
+        return true;
+    }
+};
+
+#endif // ALEEFORTH_BLOCKFILE_HPP
+
@@ -0,0 +1,206 @@
+unsigned char alee_dat[ALEE_RODICTSIZE] = {
+  0x0a, 0x00, 0x7a, 0x09, 0x66, 0x09, 0x00, 0x00, 0x6a, 0x09, 0x2e, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x09, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7a, 0x09, 0xae, 0x00, 0x03, 0x00, 0x73, 0x79,
+  0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2a, 0x00, 0x08, 0x00,
+  0x01, 0x00, 0x1a, 0x00, 0x83, 0x02, 0x73, 0x3e, 0x64, 0x00, 0x8c, 0x00,
+  0x08, 0x00, 0x1a, 0x00, 0x01, 0x03, 0x2f, 0x00, 0x0d, 0x00, 0x8c, 0x00,
+  0x08, 0x00, 0x0e, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x01, 0x04, 0x25, 0x00,
+  0x0d, 0x00, 0x8c, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x1a, 0x00,
+  0x03, 0x04, 0x75, 0x6d, 0x2a, 0x00, 0x8b, 0x00, 0x03, 0x00, 0x8b, 0x00,
+  0x29, 0x00, 0x1a, 0x00, 0x05, 0x04, 0x63, 0x65, 0x6c, 0x6c, 0x2b, 0x00,
+  0x8d, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x85, 0x03, 0x63, 0x68, 0x61, 0x72,
+  0x2b, 0x00, 0x8c, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x85, 0x03, 0x63, 0x68,
+  0x61, 0x72, 0x73, 0x00, 0x1a, 0x00, 0x81, 0x02, 0x2e, 0x00, 0x8b, 0x00,
+  0x05, 0x00, 0x1a, 0x00, 0x82, 0x02, 0x31, 0x2d, 0x8c, 0x00, 0x07, 0x00,
+  0x1a, 0x00, 0x81, 0x02, 0x27, 0x00, 0x18, 0x00, 0x01, 0x00, 0x1a, 0x00,
+  0x81, 0x02, 0x21, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x81, 0x02,
+  0x40, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x82, 0x02, 0x2b, 0x21,
+  0x02, 0x00, 0x0d, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x87, 0x06,
+  0x5f, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x74, 0x00, 0x8f, 0x00, 0x1a, 0x00,
+  0x83, 0x03, 0x69, 0x6d, 0x6d, 0x00, 0x8f, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x02, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0xab, 0x00, 0x12, 0x00, 0x03, 0x00,
+  0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x89, 0x07, 0x69, 0x6d, 0x6d, 0x65,
+  0x64, 0x69, 0x61, 0x74, 0x65, 0x00, 0x7a, 0x01, 0x1a, 0x00, 0x21, 0x04,
+  0x5b, 0x00, 0x8b, 0x00, 0x91, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00,
+  0x81, 0x03, 0x5d, 0x00, 0x8c, 0x00, 0x91, 0x00, 0x8c, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x81, 0x03, 0x2c, 0x00, 0x8d, 0x00, 0x8d, 0x00, 0x0d, 0x00,
+  0x8c, 0x00, 0x0b, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x02, 0x00,
+  0x50, 0x01, 0x1a, 0x00, 0xa7, 0x06, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61,
+  0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x01, 0xc2, 0x01, 0x1a, 0x00,
+  0x23, 0x05, 0x5b, 0x27, 0x5d, 0x00, 0x18, 0x00, 0x01, 0x00, 0xe2, 0x01,
+  0x1a, 0x00, 0x84, 0x03, 0x62, 0x61, 0x73, 0x65, 0x8b, 0x00, 0x1a, 0x00,
+  0x84, 0x02, 0x68, 0x65, 0x72, 0x65, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x1a, 0x00, 0x85, 0x03, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x00, 0x8d, 0x00,
+  0x50, 0x01, 0x1a, 0x00, 0x85, 0x03, 0x73, 0x74, 0x61, 0x74, 0x65, 0x00,
+  0x91, 0x00, 0x1a, 0x00, 0x07, 0x03, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x78,
+  0x74, 0x00, 0x93, 0x00, 0x1a, 0x00, 0x87, 0x03, 0x5f, 0x73, 0x6f, 0x75,
+  0x72, 0x63, 0x65, 0x00, 0x95, 0x00, 0x1a, 0x00, 0x88, 0x03, 0x5f, 0x73,
+  0x6f, 0x75, 0x72, 0x63, 0x65, 0x75, 0x97, 0x00, 0x1a, 0x00, 0x86, 0x03,
+  0x5f, 0x6f, 0x72, 0x64, 0x65, 0x72, 0xa1, 0x00, 0x1a, 0x00, 0x03, 0x03,
+  0x3e, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x1a, 0x00, 0x02, 0x03,
+  0x63, 0x21, 0x8b, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x82, 0x02, 0x63, 0x40,
+  0x8b, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x82, 0x02, 0x63, 0x2c, 0x8d, 0x00,
+  0x8c, 0x00, 0x0b, 0x00, 0x8b, 0x00, 0x0c, 0x00, 0x8c, 0x00, 0x8d, 0x00,
+  0x50, 0x01, 0x1a, 0x00, 0xa2, 0x05, 0x69, 0x66, 0x54, 0x00, 0x1a, 0x00,
+  0x24, 0x02, 0x74, 0x68, 0x65, 0x6e, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x03, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x24, 0x05, 0x65, 0x6c,
+  0x73, 0x65, 0x00, 0x00, 0x1d, 0x00, 0xc2, 0x01, 0x8d, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x8b, 0x00, 0xc2, 0x01, 0x03, 0x00, 0x8d, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x03, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0xa8, 0x09,
+  0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65, 0x18, 0x00, 0x02, 0x00,
+  0x8b, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0xf2, 0x02, 0x1a, 0x00, 0x8c, 0x00,
+  0x0f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x01, 0xc2, 0x01,
+  0x1c, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x19, 0x00, 0xc2, 0x01, 0x1d, 0x00,
+  0x14, 0x03, 0x00, 0x00, 0xc2, 0x01, 0xc2, 0x01, 0x1a, 0x00, 0x05, 0x0f,
+  0x32, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x01, 0x00, 0x01, 0x00, 0x1a, 0x00,
+  0x85, 0x03, 0x32, 0x6f, 0x76, 0x65, 0x72, 0x00, 0x8e, 0x00, 0x04, 0x00,
+  0x8e, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x87, 0x04, 0x64, 0x65, 0x63, 0x69,
+  0x6d, 0x61, 0x6c, 0x00, 0x95, 0x00, 0x8b, 0x00, 0x8c, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x23, 0x05, 0x32, 0x72, 0x3e, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0xc2, 0x01, 0x00, 0x00, 0x0e, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x03, 0x00,
+  0xc2, 0x01, 0x1a, 0x00, 0xa3, 0x06, 0x32, 0x3e, 0x72, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x0d, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0xc2, 0x01, 0x1a, 0x00, 0xa2, 0x06, 0x72, 0x40, 0x00, 0x00,
+  0x0e, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x02, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x0d, 0x00, 0xc2, 0x01, 0x1a, 0x00, 0x02, 0x06, 0x32, 0x21, 0x03, 0x00,
+  0x5c, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x8d, 0x00, 0x06, 0x00, 0x8c, 0x00,
+  0x0c, 0x00, 0x1a, 0x00, 0x82, 0x05, 0x32, 0x40, 0x02, 0x00, 0x8d, 0x00,
+  0x06, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x1a, 0x00, 0x82, 0x05, 0x3c, 0x3d, 0x61, 0x00, 0x10, 0x00, 0x0d, 0x00,
+  0x0f, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x1a, 0x00, 0x81, 0x04, 0x3e, 0x00,
+  0x03, 0x00, 0x10, 0x00, 0x1a, 0x00, 0x82, 0x02, 0x3c, 0x3e, 0x0f, 0x00,
+  0x63, 0x00, 0x1a, 0x00, 0xa5, 0x02, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x00,
+  0x8b, 0x00, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0xa5, 0x04,
+  0x77, 0x68, 0x69, 0x6c, 0x65, 0x00, 0x03, 0x00, 0x65, 0x00, 0x03, 0x00,
+  0x00, 0x00, 0x9c, 0x02, 0x19, 0x00, 0x5e, 0x00, 0x1a, 0x00, 0x26, 0x06,
+  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x00, 0x00, 0x1d, 0x00, 0xc2, 0x01,
+  0xc2, 0x01, 0x1c, 0x00, 0x2c, 0x04, 0x00, 0x00, 0xa6, 0x02, 0x19, 0x00,
+  0x1a, 0x00, 0x25, 0x07, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x00, 0x54, 0x00,
+  0x8c, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x1a, 0x00, 0xa2, 0x04, 0x64, 0x6f,
+  0x00, 0x00, 0x3a, 0x00, 0xc2, 0x01, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x8b, 0x00, 0xc2, 0x01, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x1a, 0x00,
+  0x25, 0x07, 0x6c, 0x65, 0x61, 0x76, 0x65, 0x00, 0x00, 0x00, 0x50, 0x03,
+  0x19, 0x00, 0x00, 0x00, 0x1e, 0x03, 0xc2, 0x01, 0x00, 0x00, 0x1a, 0x00,
+  0xc2, 0x01, 0x1a, 0x00, 0x25, 0x07, 0x2b, 0x6c, 0x6f, 0x6f, 0x70, 0x00,
+  0x00, 0x00, 0x3c, 0x00, 0xc2, 0x01, 0xc2, 0x01, 0x8d, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x8d, 0x00, 0x07, 0x00, 0x03, 0x00, 0x8c, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0xa4, 0x08, 0x6c, 0x6f, 0x6f, 0x70, 0x00, 0x00, 0x3b, 0x00,
+  0xc2, 0x01, 0xc2, 0x01, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x8d, 0x00,
+  0x07, 0x00, 0x03, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x07, 0x08,
+  0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x00, 0x02, 0x00, 0x8c, 0x00,
+  0x03, 0x00, 0x5c, 0x00, 0x11, 0x00, 0x1c, 0x00, 0xde, 0x04, 0x8d, 0x00,
+  0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x1d, 0x00, 0xe0, 0x04, 0x01, 0x00,
+  0x1a, 0x00, 0x05, 0x0a, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x00, 0x8d, 0x00,
+  0x8c, 0x00, 0x0b, 0x00, 0x02, 0x00, 0xc4, 0x04, 0x03, 0x00, 0x07, 0x00,
+  0x8d, 0x00, 0x50, 0x01, 0x1a, 0x00, 0x03, 0x07, 0x61, 0x6e, 0x64, 0x00,
+  0x11, 0x00, 0x1a, 0x00, 0x82, 0x02, 0x6f, 0x72, 0x12, 0x00, 0x1a, 0x00,
+  0x03, 0x02, 0x78, 0x6f, 0x72, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x86, 0x02,
+  0x6c, 0x73, 0x68, 0x69, 0x66, 0x74, 0x14, 0x00, 0x1a, 0x00, 0x06, 0x03,
+  0x72, 0x73, 0x68, 0x69, 0x66, 0x74, 0x15, 0x00, 0x1a, 0x00, 0x03, 0x03,
+  0x6d, 0x6f, 0x64, 0x00, 0xd8, 0x00, 0x1a, 0x00, 0x82, 0x02, 0x32, 0x2a,
+  0x8d, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x04, 0x03, 0x5f, 0x6d,
+  0x73, 0x62, 0x00, 0x00, 0x00, 0x80, 0x1a, 0x00, 0x02, 0x03, 0x32, 0x2f,
+  0x02, 0x00, 0x8c, 0x00, 0x15, 0x00, 0x03, 0x00, 0x64, 0x00, 0x1c, 0x00,
+  0x6c, 0x05, 0x00, 0x00, 0x00, 0x80, 0x12, 0x00, 0x1a, 0x00, 0x84, 0x06,
+  0x2f, 0x6d, 0x6f, 0x64, 0x0d, 0x00, 0x8c, 0x00, 0x08, 0x00, 0x0e, 0x00,
+  0x2c, 0x00, 0x1a, 0x00, 0x82, 0x04, 0x2a, 0x2f, 0x0d, 0x00, 0x08, 0x00,
+  0x0e, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x85, 0x03, 0x2a, 0x2f, 0x6d, 0x6f,
+  0x64, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x2c, 0x00, 0x1a, 0x00,
+  0x82, 0x04, 0x63, 0x72, 0x95, 0x00, 0x2e, 0x00, 0x1a, 0x00, 0x82, 0x02,
+  0x62, 0x6c, 0xab, 0x00, 0x1a, 0x00, 0x05, 0x02, 0x73, 0x70, 0x61, 0x63,
+  0x65, 0x00, 0xab, 0x00, 0x2e, 0x00, 0x1a, 0x00, 0x86, 0x03, 0x73, 0x70,
+  0x61, 0x63, 0x65, 0x73, 0x02, 0x00, 0x8b, 0x00, 0x03, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0xe0, 0x05, 0xab, 0x00, 0x2e, 0x00, 0x8c, 0x00, 0x07, 0x00,
+  0x1d, 0x00, 0xc8, 0x05, 0x01, 0x00, 0x1a, 0x00, 0x04, 0x09, 0x3f, 0x64,
+  0x75, 0x70, 0x02, 0x00, 0x1c, 0x00, 0xf2, 0x05, 0x02, 0x00, 0x1a, 0x00,
+  0x06, 0x04, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x95, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x97, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x84, 0x05,
+  0x6b, 0x65, 0x79, 0x3f, 0x95, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x8b, 0x00, 0x0b, 0x00,
+  0x8b, 0x00, 0x0f, 0x00, 0x63, 0x00, 0x1a, 0x00, 0x85, 0x08, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x00, 0x02, 0x00, 0x8c, 0x00, 0x06, 0x00, 0x03, 0x00,
+  0x8b, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x84, 0x05, 0x63, 0x68, 0x61, 0x72,
+  0x8b, 0x00, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x8c, 0x00, 0x06, 0x00,
+  0x8b, 0x00, 0x0c, 0x00, 0xab, 0x00, 0x24, 0x00, 0x8c, 0x00, 0x06, 0x00,
+  0x8b, 0x00, 0x0b, 0x00, 0x1a, 0x00, 0x26, 0x09, 0x5b, 0x63, 0x68, 0x61,
+  0x72, 0x5d, 0x48, 0x06, 0x00, 0x00, 0xe2, 0x01, 0x19, 0x00, 0x1a, 0x00,
+  0xa1, 0x04, 0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x25, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x1a, 0x00, 0x22, 0x04, 0x73, 0x22, 0x91, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x1c, 0x00, 0xa6, 0x06, 0x00, 0x00, 0x1d, 0x00, 0xc2, 0x01,
+  0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x8b, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x22, 0x00, 0x24, 0x00, 0x34, 0x06, 0x91, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x63, 0x00, 0x1c, 0x00, 0xbc, 0x06, 0x1a, 0x00, 0x02, 0x00, 0x8d, 0x00,
+  0x06, 0x00, 0x8d, 0x00, 0x50, 0x01, 0x5d, 0x00, 0x8d, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x03, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xe2, 0x01, 0x19, 0x00, 0x00, 0x00, 0xe2, 0x01, 0x19, 0x00, 0x1a, 0x00,
+  0x22, 0x17, 0x2e, 0x22, 0x00, 0x00, 0x8c, 0x06, 0x19, 0x00, 0x91, 0x00,
+  0x8c, 0x00, 0x0b, 0x00, 0x1c, 0x00, 0x02, 0x07, 0x00, 0x00, 0x2f, 0x00,
+  0xc2, 0x01, 0x1d, 0x00, 0x04, 0x07, 0x2f, 0x00, 0x1a, 0x00, 0x87, 0x08,
+  0x3a, 0x6e, 0x6f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x8d, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x8b, 0x00, 0xc2, 0x01, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x02, 0x00, 0x93, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x8c, 0x00,
+  0x91, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x87, 0x0b, 0x5f, 0x63,
+  0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x16, 0x00, 0x03, 0x00, 0xc2, 0x01,
+  0x00, 0x00, 0x1b, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x06, 0x06, 0x63, 0x72,
+  0x65, 0x61, 0x74, 0x65, 0x00, 0x00, 0x55, 0x00, 0x3e, 0x07, 0x1a, 0x00,
+  0x05, 0x04, 0x3e, 0x62, 0x6f, 0x64, 0x79, 0x00, 0x8f, 0x00, 0x06, 0x00,
+  0x1a, 0x00, 0x86, 0x03, 0x5f, 0x64, 0x6f, 0x65, 0x73, 0x3e, 0x0d, 0x00,
+  0x93, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x5c, 0x00,
+  0x8c, 0x00, 0x0c, 0x00, 0x8d, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x8d, 0x00,
+  0x06, 0x00, 0x03, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x25, 0x0b,
+  0x64, 0x6f, 0x65, 0x73, 0x3e, 0x00, 0x91, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x1c, 0x00, 0xca, 0x07, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x8d, 0x00,
+  0x8c, 0x00, 0x0b, 0x00, 0x8f, 0x00, 0x06, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x72, 0x07, 0xc2, 0x01, 0x00, 0x00, 0x1a, 0x00, 0xc2, 0x01, 0x1d, 0x00,
+  0xec, 0x07, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x72, 0x07,
+  0x8b, 0x00, 0xc2, 0x01, 0x02, 0x00, 0x8d, 0x00, 0x06, 0x00, 0x93, 0x00,
+  0x8c, 0x00, 0x0c, 0x00, 0x8c, 0x00, 0x91, 0x00, 0x8c, 0x00, 0x0c, 0x00,
+  0x1a, 0x00, 0x08, 0x16, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x00, 0x00, 0x55, 0x00, 0x3e, 0x07, 0x8d, 0x00, 0x8d, 0x00, 0x50, 0x01,
+  0x1a, 0x00, 0x08, 0x06, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
+  0x00, 0x00, 0x56, 0x00, 0x3e, 0x07, 0xc2, 0x01, 0x1a, 0x00, 0x04, 0x05,
+  0x71, 0x75, 0x69, 0x74, 0x1f, 0x00, 0x8c, 0x00, 0x03, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x34, 0x08, 0x0e, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x20, 0x08,
+  0x00, 0x00, 0xa6, 0x01, 0x19, 0x00, 0x1a, 0x00, 0x85, 0x08, 0x61, 0x62,
+  0x6f, 0x72, 0x74, 0x00, 0x1e, 0x00, 0x8b, 0x00, 0x03, 0x00, 0x10, 0x00,
+  0x1c, 0x00, 0x56, 0x08, 0x01, 0x00, 0x1d, 0x00, 0x44, 0x08, 0x20, 0x08,
+  0x1a, 0x00, 0xa6, 0x07, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x22, 0x00, 0x00,
+  0x8c, 0x06, 0x19, 0x00, 0x00, 0x00, 0x5d, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x9c, 0x02, 0x19, 0x00, 0x00, 0x00, 0x2f, 0x00, 0xc2, 0x01, 0x00, 0x00,
+  0x44, 0x08, 0xc2, 0x01, 0x00, 0x00, 0xba, 0x02, 0x19, 0x00, 0x00, 0x00,
+  0x1e, 0x03, 0xc2, 0x01, 0x00, 0x00, 0xa6, 0x02, 0x19, 0x00, 0x1a, 0x00,
+  0xa7, 0x0e, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x65, 0x00, 0x93, 0x00,
+  0x8c, 0x00, 0x0b, 0x00, 0xc2, 0x01, 0x1a, 0x00, 0x0c, 0x05, 0x65, 0x6e,
+  0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x3f, 0x01, 0x00,
+  0x01, 0x00, 0x8b, 0x00, 0x1a, 0x00, 0x88, 0x05, 0x65, 0x76, 0x61, 0x6c,
+  0x75, 0x61, 0x74, 0x65, 0x95, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x0d, 0x00,
+  0x97, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x8c, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x8c, 0x00, 0x0c, 0x00, 0x97, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x95, 0x00,
+  0x8c, 0x00, 0x0c, 0x00, 0x21, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2c, 0x00,
+  0x8c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x97, 0x00, 0x8c, 0x00, 0x0c, 0x00,
+  0x0e, 0x00, 0x95, 0x00, 0x8c, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x02, 0x16,
+  0x3c, 0x23, 0x00, 0x00, 0x28, 0x00, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00,
+  0x8b, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x02, 0x05, 0x23, 0x3e, 0x01, 0x00,
+  0x01, 0x00, 0x8d, 0x00, 0x8c, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x8b, 0x00,
+  0x0b, 0x00, 0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x8d, 0x00, 0x8c, 0x00,
+  0x0b, 0x00, 0x8b, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x04, 0x0a,
+  0x73, 0x69, 0x67, 0x6e, 0x64, 0x00, 0x1c, 0x00, 0x64, 0x09, 0x00, 0x00,
+  0x2d, 0x00, 0x37, 0x00, 0x1a, 0x00, 0x02, 0x05, 0x75, 0x2e, 0x8b, 0x00,
+  0x1a, 0x09, 0xab, 0x00, 0x37, 0x00, 0x39, 0x00, 0x2e, 0x09, 0x2f, 0x00,
+  0x1a, 0x00
+};
+unsigned int alee_dat_len = 2426;
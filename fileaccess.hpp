@@ -0,0 +1,383 @@
+//
+/// @file fileaccess.hpp
+/// @brief File-access word-set support for hosted builds.
+//
+// Alee Forth: A portable and concise Forth implementation in modern C++.
+// Copyright (C) 2023  Clyne Sullivan <clyne@bitgloo.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ALEEFORTH_FILEACCESS_HPP
+#define ALEEFORTH_FILEACCESS_HPP
+
+#include "libalee/alee.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class FileAccess
+ * Implements the file-access word-set (see forth/file.fth) on top of C
+ * streams with large buffers. File identifiers given to Forth are indices
+ * into a small table of open files, plus one.
+ */
+class FileAccess
+{
+public:
+    /** Function that reports a failed line of an included file. */
+    using ReportFunc = void (*)(State&, Error, std::string_view);
+
+    /** Size of each open file's stream buffer, in bytes. */
+    constexpr static std::size_t BufferSize = 64 * 1024;
+
+    /** Maximum number of files that may be open at once. */
+    constexpr static unsigned MaxFiles = 16;
+
+    /** I/O result for a file that could not be opened. */
+    constexpr static Cell NoFile = -38;
+
+    /** I/O result for any other failure. */
+    constexpr static Cell IOError = -37;
+
+    /**
+     * @param r Function used to report errors in included files.
+     */
+    explicit FileAccess(ReportFunc r):
+        report(r) {}
+
+    ~FileAccess() {
+        for (auto f : files) {
+            if (f != nullptr)
+                std::fclose(f);
+        }
+    }
+
+    FileAccess(const FileAccess&) = delete;
+    FileAccess& operator=(const FileAccess&) = delete;
+
+    /**
+     * Evaluates the named file. Each failing line is reported and followed
+     * by a state reset, then evaluation continues.
+     * @return Error::exit if the file ended with a "bye" line, otherwise
+     * Error::file if the file could not be opened or Error::none.
+     */
+    Error include(State& state, const char *path) {
+        auto f = std::fopen(path, "rb");
+        if (f == nullptr)
+            return Error::file;
+
+        std::setvbuf(f, nullptr, _IOFBF, BufferSize);
+        const auto r = include(state, f, true);
+        std::fclose(f);
+        return r;
+    }
+
+    /**
+     * Evaluates the given file line by line, streaming each line straight
+     * into the parser. The state's input source and execution context are
+     * restored afterwards, so this may be called while a word executes.
+     * A line reading "bye" ends the file.
+     * @param state The state to evaluate with.
+     * @param f The file to read from.
+     * @param resume If true, failing lines are followed by a state reset and
+     * evaluation continues. Otherwise the first failure ends evaluation.
+     * @return Error::exit if a "bye" line was found, the error that ended
+     * evaluation, or Error::none.
+     */
+    Error include(State& state, std::FILE *f, bool resume) {
+        uint8_t input[Dictionary::Begin - Dictionary::Input];
+        const auto source = state.dict.read(Dictionary::Source);
+        const auto sourcelen = state.dict.read(Dictionary::SourceLen);
+        for (Addr i = 0; i < sizeof(input); ++i)
+            input[i] = state.dict.readbyte(static_cast<Addr>(Dictionary::Input + i));
+
+        const auto ctx = state.save();
+        state.ip() = 0;
+
+        std::vector<char> buf (BufferSize);
+        std::size_t len = 0;
+        Error r = Error::none;
+
+        while (r == Error::none) {
+            const auto n = std::fread(buf.data() + len, 1, buf.size() - len, f);
+            const auto end = buf.data() + len + n;
+            auto line = buf.data();
+
+            for (char *eol; r == Error::none &&
+                 (eol = std::find(line, end, '\n')) != end; line = eol + 1)
+            {
+                r = evaluate(state, {line, static_cast<std::size_t>(eol - line)}, resume);
+            }
+
+            len = static_cast<std::size_t>(end - line);
+            if (r == Error::none && (n == 0 || len == buf.size())) {
+                // Last line of the file, or a line longer than the buffer.
+                if (len > 0)
+                    r = evaluate(state, {line, len}, resume);
+                len = 0;
+                if (n == 0)
+                    break;
+            } else {
+                std::copy(line, end, buf.data());
+            }
+        }
+
+        state.load(ctx);
+        state.dict.write(Dictionary::Source, source);
+        state.dict.write(Dictionary::SourceLen, sourcelen);
+        for (Addr i = 0; i < sizeof(input); ++i)
+            state.dict.writebyte(static_cast<Addr>(Dictionary::Input + i), input[i]);
+
+        return r;
+    }
+
+    /**
+     * Executes the file-access `sys` call with the given number, if any.
+     * @param state The state to operate on.
+     * @param sys The `sys` call number.
+     */
+    void sys(State& state, Cell sys) {
+        switch (sys) {
+        case 30: // open-file ( addr u fam -- fileid ior )
+        case 31: // create-file ( addr u fam -- fileid ior )
+            {
+            static const char *modes[] = { "rb", "r+b", "r+b", "w+b" };
+            const auto fam = state.pop() & 3;
+            const auto name = string(state);
+            auto f = std::fopen(name.c_str(), modes[sys == 31 ? 3 : fam]);
+            open(state, f);
+            }
+            break;
+        case 32: // close-file ( fileid -- ior )
+            {
+            const auto id = static_cast<Addr>(state.top());
+            if (auto f = file(state); f) {
+                files[id - 1] = nullptr;
+                state.push(std::fclose(f) == 0 ? 0 : IOError);
+            } else {
+                state.push(IOError);
+            }
+            }
+            break;
+        case 33: // read-file ( addr u fileid -- u ior )
+            {
+            auto f = file(state);
+            const auto u = static_cast<Addr>(state.pop());
+            const auto addr = static_cast<Addr>(state.pop());
+            std::size_t n = 0;
+
+            if (f == nullptr) {
+                // Nothing to read.
+            } else if (auto p = state.dict.contiguous(addr, u); p) {
+                n = std::fread(p, 1, u, f);
+            } else {
+                for (int c; n < u && (c = std::getc(f)) != EOF; ++n) {
+                    state.dict.writebyte(static_cast<Addr>(addr + n),
+                                         static_cast<uint8_t>(c));
+                }
+            }
+
+            state.push(static_cast<Cell>(n));
+            state.push(f && !std::ferror(f) ? 0 : IOError);
+            }
+            break;
+        case 34: // read-line ( addr u fileid -- u flag ior )
+            {
+            auto f = file(state);
+            const auto u = static_cast<Addr>(state.pop());
+            const auto addr = static_cast<Addr>(state.pop());
+            Addr n = 0;
+            int c = EOF;
+
+            while (f && n < u && (c = std::getc(f)) != EOF && c != '\n') {
+                if (c == '\r') {
+                    if (c = std::getc(f); c == '\n')
+                        break;
+                    std::ungetc(c, f);
+                    c = '\r';
+                }
+
+                state.dict.writebyte(static_cast<Addr>(addr + n++),
+                                     static_cast<uint8_t>(c));
+            }
+
+            state.push(static_cast<Cell>(n));
+            state.push(n > 0 || c != EOF ? -1 : 0);
+            state.push(f && !std::ferror(f) ? 0 : IOError);
+            }
+            break;
+        case 35: // write-file ( addr u fileid -- ior )
+        case 36: // write-line ( addr u fileid -- ior )
+            {
+            auto f = file(state);
+            const auto u = static_cast<Addr>(state.pop());
+            const auto addr = static_cast<Addr>(state.pop());
+            bool ok = f != nullptr;
+
+            if (!ok) {
+                // Nothing to write to.
+            } else if (auto p = state.dict.contiguous(addr, u); p) {
+                ok = std::fwrite(p, 1, u, f) == u;
+            } else {
+                for (Addr i = 0; ok && i < u; ++i)
+                    ok = std::putc(state.dict.readbyte(static_cast<Addr>(addr + i)), f) != EOF;
+            }
+
+            if (ok && sys == 36)
+                ok = std::putc('\n', f) != EOF;
+
+            state.push(ok ? 0 : IOError);
+            }
+            break;
+        case 37: // file-position ( fileid -- ud ior )
+            {
+            auto f = file(state);
+            pushud(state, f ? std::ftell(f) : -1);
+            }
+            break;
+        case 38: // reposition-file ( ud fileid -- ior )
+            {
+            auto f = file(state);
+            const auto hi = static_cast<Addr>(state.pop());
+            const auto lo = static_cast<Addr>(state.pop());
+            const long pos = static_cast<long>(hi) << (sizeof(Cell) * 8) | lo;
+            state.push(f && std::fseek(f, pos, SEEK_SET) == 0 ? 0 : IOError);
+            }
+            break;
+        case 39: // file-size ( fileid -- ud ior )
+            if (auto f = file(state); f) {
+                const auto pos = std::ftell(f);
+                std::fseek(f, 0, SEEK_END);
+                pushud(state, std::ftell(f));
+                std::fseek(f, pos, SEEK_SET);
+            } else {
+                pushud(state, -1);
+            }
+            break;
+        case 40: // delete-file ( addr u -- ior )
+            state.push(std::remove(string(state).c_str()) == 0 ? 0 : IOError);
+            break;
+        case 41: // include-file ( fileid -- )
+            {
+            auto f = file(state);
+            state.verify(f != nullptr, Error::file);
+            nested(state, f);
+            }
+            break;
+        case 42: // included ( addr u -- )
+            {
+            auto f = std::fopen(string(state).c_str(), "rb");
+            state.verify(f != nullptr, Error::file);
+            std::setvbuf(f, nullptr, _IOFBF, BufferSize);
+            // Closed before any error in the file leaves this call.
+            const auto r = include(state, f, false);
+            std::fclose(f);
+            state.verify(r == Error::none || r == Error::exit, r);
+            }
+            break;
+        case 43: // flush-file ( fileid -- ior )
+            {
+            auto f = file(state);
+            state.push(f && std::fflush(f) == 0 ? 0 : IOError);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+private:
+    ReportFunc report;
+    std::FILE *files[MaxFiles] = {};
+
+    /**
+     * Pops a file identifier, returning its open file or nullptr.
+     */
+    std::FILE *file(State& state) {
+        const auto id = static_cast<Addr>(state.pop());
+        return id > 0 && id <= MaxFiles ? files[id - 1] : nullptr;
+    }
+
+    /** Gives the opened file an identifier, pushing it and a result. */
+    void open(State& state, std::FILE *f) {
+        if (f != nullptr) {
+            for (unsigned i = 0; i < MaxFiles; ++i) {
+                if (files[i] == nullptr) {
+                    std::setvbuf(f, nullptr, _IOFBF, BufferSize);
+                    files[i] = f;
+                    state.push(static_cast<Cell>(i + 1));
+                    state.push(0);
+                    return;
+                }
+            }
+
+            std::fclose(f);
+        }
+
+        state.push(0);
+        state.push(NoFile);
+    }
+
+    /** Pops a string given by address and length. */
+    static std::string string(State& state) {
+        const auto u = static_cast<Addr>(state.pop());
+        const auto addr = static_cast<Addr>(state.pop());
+        std::string str (u, '\0');
+
+        for (Addr i = 0; i < u; ++i)
+            str[i] = static_cast<char>(state.dict.readbyte(static_cast<Addr>(addr + i)));
+
+        return str;
+    }
+
+    /** Pushes a file offset as an unsigned double followed by a result. */
+    static void pushud(State& state, long pos) {
+        const auto ud = static_cast<DoubleAddr>(pos);
+        state.push(static_cast<Cell>(ud));
+        state.push(static_cast<Cell>(ud >> (sizeof(Cell) * 8)));
+        state.push(pos >= 0 ? 0 : IOError);
+    }
+
+    /** Includes a file from within executing code; errors propagate. */
+    void nested(State& state, std::FILE *f) {
+        const auto r = include(state, f, false);
+        state.verify(r == Error::none || r == Error::exit, r);
+    }
+
+    /** Evaluates a single line of an included file. */
+    Error evaluate(State& state, std::string_view line, bool resume) {
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        if (line == "bye")
+            return Error::exit;
+
+        auto r = Parser::parse(state, line);
+        if (r != Error::none) {
+            report(state, r, line);
+
+            if (resume) {
+                state.reset();
+                r = Error::none;
+            }
+        }
+
+        return r;
+    }
+};
+
+#endif // ALEEFORTH_FILEACCESS_HPP
+
@@ -0,0 +1,170 @@
+//
+/// @file guardstack.hpp
+/// @brief Stack memory bounded by guard pages, for POSIX hosts.
+//
+// Alee Forth: A portable and concise Forth implementation in modern C++.
+// Copyright (C) 2023  Clyne Sullivan <clyne@bitgloo.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ALEEFORTH_GUARDSTACK_HPP
+#define ALEEFORTH_GUARDSTACK_HPP
+
+#include "libalee/alee.hpp"
+
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+/**
+ * @class GuardedStacks
+ * Provides data and return stack memory with an inaccessible page on either
+ * side of each stack. With libalee built with ALEE_GUARD_PAGES, State skips
+ * its bounds checks and the resulting page faults are turned into the
+ * matching Error instead. Memory is reserved but only committed as pages are
+ * first touched, so the stacks can be sized generously.
+ */
+class GuardedStacks
+{
+    /** One stack's mapping. */
+    struct Region {
+        uint8_t *map = nullptr; /** Entire mapping, including guard pages */
+        std::size_t mapsize = 0; /** Size of the mapping in bytes */
+        std::size_t cells = 0; /** Usable size of the stack, number of cells */
+        Error under; /** Error reported for a fault below the stack */
+        Error over; /** Error reported for a fault above the stack */
+
+        Region(std::size_t n, Error u, Error o): under(u), over(o) {
+            const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            const auto bytes = (n * sizeof(Cell) + page - 1) & ~(page - 1);
+
+            void *m = mmap(nullptr, bytes + 2 * page, PROT_NONE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (m != MAP_FAILED) {
+                map = static_cast<uint8_t *>(m);
+                mapsize = bytes + 2 * page;
+                if (mprotect(map + page, bytes, PROT_READ | PROT_WRITE) == 0)
+                    cells = bytes / sizeof(Cell);
+            }
+        }
+
+        ~Region() {
+            if (map != nullptr)
+                munmap(map, mapsize);
+        }
+
+        Region(const Region&) = delete;
+        Region& operator=(const Region&) = delete;
+
+        Cell *data() const noexcept {
+            return reinterpret_cast<Cell *>(map + (mapsize - cells * sizeof(Cell)) / 2);
+        }
+
+        /** Returns the error for a fault at the given address, if any. */
+        Error classify(const uint8_t *addr) const noexcept {
+            const auto stack = reinterpret_cast<const uint8_t *>(data());
+
+            if (addr >= map && addr < stack)
+                return under;
+            else if (addr >= stack + cells * sizeof(Cell) && addr < map + mapsize)
+                return over;
+            else
+                return Error::none;
+        }
+    };
+
+    Region dstack;
+    Region rstack;
+    State *state = nullptr; /** State that uses these stacks, once attached */
+    GuardedStacks *next = nullptr; /** Next attached GuardedStacks */
+
+    static inline GuardedStacks *attached = nullptr;
+
+    static void onFault(int, siginfo_t *info, void *) {
+        const auto addr = static_cast<const uint8_t *>(info->si_addr);
+
+        for (auto gs = attached; gs != nullptr; gs = gs->next) {
+            auto err = gs->dstack.classify(addr);
+            if (err == Error::none)
+                err = gs->rstack.classify(addr);
+
+            // Leaves the handler through the state's execute() frame,
+            // restoring the signal mask saved there.
+            if (err != Error::none)
+                gs->state->fault(err);
+        }
+
+        // Not a stack fault: let the fault happen again, this time fatally.
+        std::signal(SIGSEGV, SIG_DFL);
+    }
+
+public:
+    /** Default size of each stack, number of cells. Keeps depth within a Cell. */
+    static constexpr std::size_t DefaultSize = 16384;
+
+    /**
+     * Maps stacks of at least the given sizes.
+     * @param dn Data stack size, number of cells
+     * @param rn Return stack size, number of cells
+     */
+    GuardedStacks(std::size_t dn = DefaultSize, std::size_t rn = DefaultSize):
+        dstack(dn, Error::pop, Error::push),
+        rstack(rn, Error::popr, Error::pushr) {}
+
+    ~GuardedStacks() {
+        for (auto gs = &attached; *gs != nullptr; gs = &(*gs)->next) {
+            if (*gs == this) {
+                *gs = next;
+                break;
+            }
+        }
+    }
+
+    GuardedStacks(const GuardedStacks&) = delete;
+    GuardedStacks& operator=(const GuardedStacks&) = delete;
+
+    /** Returns true if both stacks were mapped successfully. */
+    bool good() const noexcept {
+        return dstack.cells > 0 && rstack.cells > 0;
+    }
+
+    Cell *data() const noexcept { return dstack.data(); }
+    std::size_t size() const noexcept { return dstack.cells; }
+    Cell *rdata() const noexcept { return rstack.data(); }
+    std::size_t rsize() const noexcept { return rstack.cells; }
+
+    /**
+     * Registers the state that uses these stacks so that faults can be
+     * reported through it, installing the SIGSEGV handler if needed.
+     */
+    void attach(State& s) {
+        if (attached == nullptr) {
+            struct sigaction sa = {};
+            sa.sa_sigaction = onFault;
+            sa.sa_flags = SA_SIGINFO;
+            sigemptyset(&sa.sa_mask);
+            sigaction(SIGSEGV, &sa, nullptr);
+        }
+
+        state = &s;
+        next = attached;
+        attached = this;
+    }
+};
+
+#endif // ALEEFORTH_GUARDSTACK_HPP
+
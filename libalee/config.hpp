@@ -3,3 +3,22 @@
 #else
 #define LIBALEE_SECTION __attribute__((section(".libalee")))
 #endif
+
+// The floating-point word-set is built in unless disabled by defining
+// ALEE_NO_FLOAT. It is left out of microcontroller builds.
+#if !defined(ALEE_NO_FLOAT) && !defined(ALEE_MSP430) && !defined(ALEE_MSP430_HOST)
+#define ALEE_FLOAT
+#endif
+
+// Groups of words that are otherwise defined in Forth are built in as
+// fundamental words unless disabled by defining ALEE_FEW_WORDS. They are
+// left out of packed builds, which have no spare short tokens, and of
+// microcontroller builds, which favor the smallest set of words.
+// Each fundamental word narrows the range of literals that compile into a
+// single cell, but the bundled libraries still compile smaller with these
+// groups than without them.
+#if !defined(ALEE_FEW_WORDS) && !defined(ALEE_PACKED) \
+    && !defined(ALEE_MSP430) && !defined(ALEE_MSP430_HOST)
+#define ALEE_STACK_WORDS
+#define ALEE_MATH_WORDS
+#endif
@@ -18,11 +18,31 @@
 
 #include "alee.hpp"
 
+#include <algorithm>
+#include <compare>
 #include <utility>
 
+#ifdef ALEE_FLOAT
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#endif // ALEE_FLOAT
+
 static void find(State&, Word);
+static uint8_t key(State&);
 static DoubleCell popd(State&);
 static void pushd(State&, DoubleCell);
+static void hold(State&, uint8_t);
+static DoubleAddr digit(State&, DoubleAddr);
+static void copy(State&, Addr, Addr, Addr, bool);
+static Cell compare(State&, Addr, Addr, Addr, Addr);
+static Cell search(State&, Addr, Addr, Addr, Addr);
+static void see(State&, Addr);
+#ifdef ALEE_FLOAT
+static Float readFloat(Dictionary&, Addr);
+static void writeFloat(Dictionary&, Addr, Float);
+#endif // ALEE_FLOAT
 
 LIBALEE_SECTION
 void CoreWords::run(Cell ins, State& state)
@@ -33,6 +53,15 @@ void CoreWords::run(Cell ins, State& state)
     Addr index = ins;
     auto& ip = state.ip();
 
+#ifdef ALEE_PACKED
+    // A packed cell runs its first token, then its second.
+    Cell pending = 0;
+    if (packed(ins)) {
+        index = static_cast<Addr>(first(ins));
+        pending = second(ins);
+    }
+#endif // ALEE_PACKED
+
 execute:
     if (index >= Dictionary::Begin) {
         // must be calling a defined subroutine
@@ -128,12 +157,25 @@ execute:
         cell = state.pop();
         reinterpret_cast<Addr&>(state.top()) >>= static_cast<Addr>(cell);
         break;
+    case token("?:"): // Like `:`, but skips the definition of a fundamental word.
+        while (!state.dict.hasInput())
+            state.input();
+        cell = state.dict.read(Dictionary::Input);
+        if (findi(state, state.dict.input()) >= 0) {
+            // Discards the definition through its `;` or the end of input.
+            for (Word word; (word = state.dict.input()).size() > 0;) {
+                if (state.dict.equal(word, ";", 1))
+                    break;
+            }
+            break;
+        }
+        state.dict.write(Dictionary::Input, cell);
+        [[fallthrough]];
     case token(":"): // Begins definition/compilation of new word.
-        state.push(state.dict.alignhere());
-        state.dict.write(Dictionary::CompToken, state.top());
         while (!state.dict.hasInput())
             state.input();
-        state.dict.addDefinition(state.dict.input());
+        state.push(static_cast<Cell>(state.dict.addDefinition(state.dict.input())));
+        state.dict.write(Dictionary::CompToken, static_cast<Cell>(state.dict.here()));
         state.compiling(true);
         break;
     case token("_'"): // Collects input word and finds execution token.
@@ -144,25 +186,26 @@ execute:
     case token("execute"):
         index = state.pop();
         goto execute;
+    // Code fields: a created word's body is the field's opcode, then `exit`
+    // or the `does>` code's address, then the word's data.
+    case token("_dovar"): // ( -- addr ): Code field of `create`.
+    case token("_doconst"): // ( -- n ): Code field of `constant`.
+    case token("_dovalue"): // ( -- n ): Code field of `value`.
+        cell = static_cast<Cell>(ip + sizeof(Cell) * 2);
+        state.push(index == token("_dovar") ? cell : state.dict.read(cell));
+        [[fallthrough]];
     case token("exit"):
         ip = state.popr();
         state.verify(ip != 0, Error::exit);
         break;
     case token(";"): // Concludes word definition.
+        if (state.dict.read(Dictionary::Locals) != 0) {
+            state.dict.add(token("_unlocals"));
+            state.dict.clearLocals();
+        }
         state.dict.add(token("exit"));
         state.compiling(false);
-
-        cell = state.pop();
-        dcell = cell - state.dict.latest();
-        if (dcell >= Dictionary::MaxDistance) {
-            // Large distance to previous entry: store in dedicated cell.
-            state.dict.write(static_cast<Addr>(cell) + sizeof(Cell),
-                static_cast<Cell>(dcell));
-            dcell = Dictionary::MaxDistance;
-        }
-        state.dict.write(cell,
-            (state.dict.read(cell) & 0x1F) | static_cast<Cell>(dcell << 6));
-        state.dict.latest(cell);
+        state.dict.link(static_cast<Addr>(state.pop()));
         break;
     case token("_jmp0"): // Jump if popped value equals zero.
         if (state.pop()) {
@@ -190,6 +233,66 @@ execute:
         state.load(st);
         }
         break;
+    case token("key"):
+        state.push(key(state));
+        break;
+    case token("word"): // ( ch -- addr ): Parses a word into a counted string.
+        {
+        auto word = state.dict.parse(static_cast<uint8_t>(state.top()), true);
+        auto addr = state.dict.here();
+        state.top() = static_cast<Cell>(addr);
+        state.dict.writebyte(addr++, static_cast<uint8_t>(word.size()));
+        for (auto it = word.begin(&state.dict); it != word.end(&state.dict); ++it)
+            state.dict.writebyte(addr++, *it);
+        }
+        break;
+    case token("parse"): // ( ch -- addr u )
+    case token("parse-name"): // ( -- addr u )
+        {
+        auto word = index == token("parse") ?
+            state.dict.parse(static_cast<uint8_t>(state.pop()), false) :
+            state.dict.input();
+        state.push(static_cast<Cell>(word.begin(&state.dict).addr));
+        state.push(static_cast<Cell>(word.size()));
+        }
+        break;
+    case token(">number"): // ( ud addr u -- ud addr u )
+        {
+        cell = state.pop();
+        auto addr = static_cast<Addr>(state.pop());
+        auto ud = static_cast<DoubleAddr>(popd(state));
+        const auto base = static_cast<Addr>(state.dict.read(Dictionary::Base));
+
+        for (; cell > 0; --cell, ++addr) {
+            const auto ch = state.dict.readbyte(addr);
+            const auto dig = static_cast<Addr>(isdigit(ch) ? ch - '0' :
+                isalpha(ch) ? (ch | 32) - 'a' + 10 : base);
+
+            if (dig >= base)
+                break;
+
+            ud = ud * base + dig;
+        }
+
+        pushd(state, static_cast<DoubleCell>(ud));
+        state.push(static_cast<Cell>(addr));
+        state.push(cell);
+        }
+        break;
+    case token("accept"): // ( addr n -- n ): Reads a line, echoing it.
+        {
+        const auto size = state.pop();
+        const auto addr = static_cast<Addr>(state.top());
+        Cell n = 0;
+
+        for (uint8_t ch; n < size && (ch = key(state)) >= 32; ++n) {
+            state.output(static_cast<char>(ch));
+            state.dict.writebyte(static_cast<Addr>(addr + n), ch);
+        }
+
+        state.top() = n;
+        }
+        break;
     case token("find"):
         cell = state.pop();
         find(state,
@@ -222,11 +325,559 @@ execute:
             static_cast<DoubleAddr>(dcell) /
             static_cast<Addr>(cell)));
         break;
+    case token("sm/rem"): // ( d n -- n n ): Symmetric division.
+    case token("fm/mod"): // ( d n -- n n ): Floored division.
+        {
+        cell = state.pop();
+        dcell = popd(state);
+
+        auto quot = dcell / cell;
+        auto rem = dcell % cell;
+        if (index == token("fm/mod") && rem != 0 && (rem < 0) != (cell < 0)) {
+            --quot;
+            rem += cell;
+        }
+
+        state.push(static_cast<Cell>(rem));
+        state.push(static_cast<Cell>(quot));
+        }
+        break;
+    case token("d+"): // ( d d -- d )
+    case token("d-"): // ( d d -- d )
+        {
+        const auto d2 = static_cast<DoubleAddr>(popd(state));
+        const auto d1 = static_cast<DoubleAddr>(popd(state));
+        pushd(state, static_cast<DoubleCell>(index == token("d+") ? d1 + d2 : d1 - d2));
+        }
+        break;
+    case token("dnegate"): // ( d -- d )
+        pushd(state, static_cast<DoubleCell>(0 - static_cast<DoubleAddr>(popd(state))));
+        break;
+    case token("d<"): // ( d d -- f )
+        dcell = popd(state);
+        state.push(popd(state) < dcell ? -1 : 0);
+        break;
+    case token("du<"): // ( ud ud -- f )
+        dcell = popd(state);
+        state.push(static_cast<DoubleAddr>(popd(state)) <
+                   static_cast<DoubleAddr>(dcell) ? -1 : 0);
+        break;
+    case token("m+"): // ( d n -- d )
+        cell = state.pop();
+        pushd(state, static_cast<DoubleCell>(
+            static_cast<DoubleAddr>(popd(state)) + static_cast<DoubleAddr>(cell)));
+        break;
+    case token("m*/"): // ( d n u -- d ): Scales d by n/u with a triple-cell product.
+        {
+        const auto div = state.pop();
+        cell = state.pop();
+        dcell = popd(state);
+        pushd(state, static_cast<DoubleCell>(static_cast<int64_t>(dcell) * cell / div));
+        }
+        break;
+    case token("emit"):
+        state.output(static_cast<char>(state.pop()));
+        break;
+    case token("type"): // ( addr u -- )
+        {
+        cell = state.pop();
+        auto addr = static_cast<Addr>(state.pop());
+
+        if (cell <= 0)
+            break;
+        if (auto p = state.dict.contiguous(addr, static_cast<Addr>(cell)); p)
+            state.output({reinterpret_cast<const char *>(p), static_cast<std::size_t>(cell)});
+        else while (cell-- > 0)
+            state.output(static_cast<char>(state.dict.readbyte(addr++)));
+        }
+        break;
+    case token("hold"):
+        hold(state, static_cast<uint8_t>(state.pop()));
+        break;
+    case token("#"): // ( ud -- ud ): Converts one digit into the hold area.
+        pushd(state, static_cast<DoubleCell>(
+            digit(state, static_cast<DoubleAddr>(popd(state)))));
+        break;
+    case token("#s"): // ( ud -- 0 0 ): Converts all digits.
+        {
+        auto ud = static_cast<DoubleAddr>(popd(state));
+        do {
+            ud = digit(state, ud);
+        } while (ud != 0);
+        pushd(state, 0);
+        }
+        break;
+    case token("_do"): // ( limit index -- ): Begins a counted loop.
+        // Return stack gets: leave address (operand), limit, index.
+        cell = state.pop();
+        state.pushr(state.beyondip());
+        state.pushr(state.pop());
+        state.pushr(cell);
+        break;
+    case token("_loop"): // Increments index, jumps to operand if not at limit.
+        if (++state.rpick(0) != state.rpick(1)) {
+            ip = state.beyondip();
+            return;
+        }
+        state.beyondip();
+        goto unloop;
+    case token("_+loop"): // ( n -- ): Like `_loop`, stepping by n.
+        {
+        cell = state.pop();
+        auto& index = state.rpick(0);
+        const auto diff = static_cast<Cell>(index - state.rpick(1));
+        index = static_cast<Cell>(index + cell);
+
+        // Continue unless index crossed the boundary between limit-1 and limit.
+        if (((diff ^ static_cast<Cell>(diff + cell)) & (diff ^ cell)) >= 0) {
+            ip = state.beyondip();
+            return;
+        }
+        }
+        state.beyondip();
+        [[fallthrough]];
+    case token("unloop"):
+    unloop:
+        state.popr();
+        state.popr();
+        state.popr();
+        break;
+    case token("i"):
+        state.push(state.rpick(0));
+        break;
+    case token("j"):
+        state.push(state.rpick(3));
+        break;
+    case token("move"): // ( src dst u -- )
+        cell = state.pop();
+        if (auto dst = static_cast<Addr>(state.pop()); cell > 0) {
+            const auto src = static_cast<Addr>(state.pop());
+            copy(state, dst, src, static_cast<Addr>(cell), dst > src);
+        } else {
+            state.pop();
+        }
+        break;
+    case token("fill"): // ( addr u c -- )
+        {
+        const auto c = static_cast<uint8_t>(state.pop());
+        cell = state.pop();
+        auto addr = static_cast<Addr>(state.pop());
+
+        if (cell <= 0)
+            break;
+        if (auto p = state.dict.contiguous(addr, static_cast<Addr>(cell)); p)
+            std::fill(p, p + cell, c);
+        else while (cell-- > 0)
+            state.dict.writebyte(addr++, c);
+        }
+        break;
+    case token("cmove"): // ( src dst u -- ): Copies from lower addresses up.
+    case token("cmove>"): // ( src dst u -- ): Copies from higher addresses down.
+        {
+        const auto u = static_cast<Addr>(state.pop());
+        const auto dst = static_cast<Addr>(state.pop());
+        const auto src = static_cast<Addr>(state.pop());
+        copy(state, dst, src, u, index == token("cmove>"));
+        }
+        break;
+    case token("compare"): // ( addr1 u1 addr2 u2 -- n )
+        {
+        const auto u2 = static_cast<Addr>(state.pop());
+        const auto a2 = static_cast<Addr>(state.pop());
+        const auto u1 = static_cast<Addr>(state.pop());
+        const auto a1 = static_cast<Addr>(state.pop());
+        state.push(compare(state, a1, u1, a2, u2));
+        }
+        break;
+    case token("search"): // ( addr1 u1 addr2 u2 -- addr3 u3 flag )
+        {
+        const auto u2 = static_cast<Addr>(state.pop());
+        const auto a2 = static_cast<Addr>(state.pop());
+        const auto u1 = static_cast<Addr>(state.pop());
+        const auto a1 = static_cast<Addr>(state.top());
+
+        cell = search(state, a1, u1, a2, u2);
+        if (cell >= 0) {
+            state.top() = static_cast<Cell>(a1 + cell);
+            state.push(static_cast<Cell>(u1 - cell));
+            state.push(-1);
+        } else {
+            state.push(static_cast<Cell>(u1));
+            state.push(0);
+        }
+        }
+        break;
+    case token("-trailing"): // ( addr u -- addr u )
+        cell = state.pop();
+        while (cell > 0 && state.dict.readbyte(
+            static_cast<Addr>(state.top() + cell - 1)) == ' ')
+        {
+            --cell;
+        }
+        state.push(cell);
+        break;
+    case token("allocate"): // ( u -- addr ior )
+        cell = static_cast<Cell>(state.dict.allocate(static_cast<Addr>(state.pop())));
+        state.push(cell);
+        state.push(cell != 0 ? 0 : -59);
+        break;
+    case token("free"): // ( addr -- ior )
+        cell = static_cast<Cell>(state.pop());
+        state.push(state.dict.deallocate(static_cast<Addr>(cell)) ? 0 : -60);
+        break;
+    case token("resize"): // ( addr u -- addr ior )
+        cell = state.pop();
+        if (auto addr = state.dict.reallocate(static_cast<Addr>(state.top()),
+                                              static_cast<Addr>(cell)); addr)
+        {
+            state.top() = static_cast<Cell>(addr);
+            state.push(0);
+        } else {
+            state.push(-61);
+        }
+        break;
+    case token("search-wordlist"): // ( addr u wid -- 0 | xt 1 | xt -1 )
+        {
+        const auto wid = static_cast<Addr>(state.pop());
+        cell = state.pop();
+        const auto addr = static_cast<Addr>(state.pop());
+        if (auto j = state.dict.find(wid,
+                Word::fromLength(addr, static_cast<Addr>(cell))); j) {
+            state.push(static_cast<Cell>(state.dict.getexec(j)));
+            state.push((state.dict.read(j) & Dictionary::Immediate) ? 1 : -1);
+        } else {
+            state.push(0);
+        }
+        }
+        break;
+    case token("index-wordlist"): // ( wid -- ): Speeds up lookups in wid.
+        state.dict.index(static_cast<Addr>(state.pop()));
+        break;
+    case token("_see"): // ( xt -- ): Decompiles the given definition.
+        see(state, static_cast<Addr>(state.pop()));
+        break;
+    case token("name>string"): // ( nt -- addr u ): Name of an entry.
+        {
+        auto word = state.dict.name(static_cast<Addr>(state.top()));
+        state.top() = static_cast<Cell>(word.begin(&state.dict).addr);
+        state.push(static_cast<Cell>(word.size()));
+        }
+        break;
+    case token("_{:"): // Parses a locals declaration, ending at `:}`.
+        {
+        // Only one declaration per definition.
+        state.verify(state.dict.read(Dictionary::Locals) == 0, Error::noword);
+
+        Cell init = 0;
+        bool initialized = true;
+        bool named = true;
+
+        for (;;) {
+            while (!state.dict.hasInput())
+                state.input();
+
+            const auto word = state.dict.input();
+            if (state.dict.equal(word, ":}", 2)) {
+                break;
+            } else if (state.dict.equal(word, "|", 1)) {
+                initialized = false;
+            } else if (state.dict.equal(word, "--", 2)) {
+                named = false;
+            } else if (named) {
+                state.verify(state.dict.addLocal(word), Error::noword);
+                init += initialized;
+            }
+        }
+
+        if (const auto table = state.dict.read(Dictionary::Locals); table != 0) {
+            state.dict.add(token("_locals"));
+            state.dict.add(static_cast<Cell>(state.dict.read(table) | init << 8));
+        }
+        }
+        break;
+    case token("_locals"): // Begins a frame; operand is count | init << 8.
+        cell = state.beyondip();
+        state.enterFrame(cell & 0xFF, (cell >> 8) & 0xFF);
+        break;
+    case token("_local@"): // ( -- n ): Fetches the local given by operand.
+        state.push(state.local(state.beyondip()));
+        break;
+    case token("_local!"): // ( n -- ): Stores to the local given by operand.
+        cell = state.pop();
+        state.local(state.beyondip()) = cell;
+        break;
+    case token("_unlocals"): // Ends the current frame of locals.
+        state.leaveFrame();
+        break;
+    case token("_lfind"): // ( c-addr -- c-addr 0 | n -1 ): Finds a local.
+        cell = state.top();
+        if (auto n = state.dict.findLocal(Word::fromLength(
+                static_cast<Addr>(cell + 1), state.dict.readbyte(cell))); n >= 0)
+        {
+            state.top() = n;
+            state.push(-1);
+        } else {
+            state.push(0);
+        }
+        break;
+    case token("_dodefer"): // Code field of `defer`: executes its xt.
+        index = state.dict.read(static_cast<Addr>(ip + sizeof(Cell) * 2));
+        goto execute;
+    case token("_dodoes"): // ( -- addr ): Code field after `does>`.
+        state.push(static_cast<Cell>(ip + sizeof(Cell) * 2));
+        ip = state.beyondip();
+        return;
+    case token("_jmptab"): // ( x -- x ): Jumps to x's branch of a case.
+        {
+        const auto table = static_cast<Addr>(state.beyondip());
+        Cell lo = 0;
+        Cell hi = state.dict.read(table);
+
+        cell = state.top();
+        ip = static_cast<Addr>(state.dict.read(static_cast<Addr>(table + sizeof(Cell))));
+
+        while (lo < hi) {
+            const auto mid = static_cast<Cell>((lo + hi) / 2);
+            const auto entry = static_cast<Addr>(table + sizeof(Cell) * (2 + 2 * mid));
+
+            if (const auto key = state.dict.read(entry); key == cell) {
+                ip = static_cast<Addr>(state.dict.read(static_cast<Addr>(entry + sizeof(Cell))));
+                break;
+            } else if (key < cell) {
+                lo = static_cast<Cell>(mid + 1);
+            } else {
+                hi = mid;
+            }
+        }
+        }
+        return;
+    case token("_endcase,"): // Compiles the end of a case, see Parser.
+        for (cell = 0; state.pick(static_cast<std::size_t>(cell)) != 0; ++cell);
+        Parser::compileJumpTable(state, static_cast<Addr>(state.pick(static_cast<std::size_t>(cell + 1))));
+        break;
+    case token("_jmp0,"): // ( -- addr ): Compiles if's or until's jump.
+        state.push(static_cast<Cell>(Parser::compileBranch(state)));
+        break;
+#ifdef ALEE_STACK_WORDS
+    case token("over"): // ( a b -- a b a )
+        state.push(state.pick(1));
+        break;
+    case token("rot"): // ( a b c -- b c a )
+        cell = state.pick(2);
+        state.pick(2) = state.pick(1);
+        state.pick(1) = state.top();
+        state.top() = cell;
+        break;
+    case token("-rot"): // ( a b c -- c a b )
+        cell = state.top();
+        state.top() = state.pick(1);
+        state.pick(1) = state.pick(2);
+        state.pick(2) = cell;
+        break;
+    case token("nip"): // ( a b -- b )
+        cell = state.pop();
+        state.top() = cell;
+        break;
+    case token("tuck"): // ( a b -- b a b )
+        cell = state.top();
+        std::swap(state.top(), state.pick(1));
+        state.push(cell);
+        break;
+    case token("2dup"): // ( a b -- a b a b )
+        state.push(state.pick(1));
+        state.push(state.pick(1));
+        break;
+    case token("2swap"): // ( a b c d -- c d a b )
+        std::swap(state.pick(3), state.pick(1));
+        std::swap(state.pick(2), state.top());
+        break;
+#endif // ALEE_STACK_WORDS
+#ifdef ALEE_MATH_WORDS
+    case token("0="):
+        state.top() = state.top() == 0 ? -1 : 0;
+        break;
+    case token("0<"):
+        state.top() = state.top() < 0 ? -1 : 0;
+        break;
+    case token("1+"):
+        state.top() = static_cast<Cell>(state.top() + 1);
+        break;
+    case token("negate"):
+        state.top() = static_cast<Cell>(-state.top());
+        break;
+    case token("invert"):
+        state.top() = static_cast<Cell>(~state.top());
+        break;
+    case token("cells"):
+        state.top() = static_cast<Cell>(state.top() * static_cast<Cell>(sizeof(Cell)));
+        break;
+    case token("min"):
+        cell = state.pop();
+        state.top() = std::min(state.top(), cell);
+        break;
+    case token("max"):
+        cell = state.pop();
+        state.top() = std::max(state.top(), cell);
+        break;
+    case token("abs"):
+        if (state.top() < 0)
+            state.top() = static_cast<Cell>(-state.top());
+        break;
+#endif // ALEE_MATH_WORDS
+#ifdef ALEE_FLOAT
+    case token("_flit"): // Execution semantics of a float literal.
+        state.fpush(readFloat(state.dict, static_cast<Addr>(ip + sizeof(Cell))));
+        ip += sizeof(Float);
+        break;
+    case token("f+"):
+        {
+        const auto f = state.fpop();
+        state.fpick(0) += f;
+        }
+        break;
+    case token("f-"):
+        {
+        const auto f = state.fpop();
+        state.fpick(0) -= f;
+        }
+        break;
+    case token("f*"):
+        {
+        const auto f = state.fpop();
+        state.fpick(0) *= f;
+        }
+        break;
+    case token("f/"):
+        {
+        const auto f = state.fpop();
+        state.fpick(0) /= f;
+        }
+        break;
+    case token("fnegate"):
+        state.fpick(0) = -state.fpick(0);
+        break;
+    case token("fabs"):
+        state.fpick(0) = std::fabs(state.fpick(0));
+        break;
+    case token("fsqrt"):
+        state.fpick(0) = std::sqrt(state.fpick(0));
+        break;
+    case token("f**"):
+        {
+        const auto f = state.fpop();
+        state.fpick(0) = std::pow(state.fpick(0), f);
+        }
+        break;
+    case token("fexp"):
+        state.fpick(0) = std::exp(state.fpick(0));
+        break;
+    case token("fln"):
+        state.fpick(0) = std::log(state.fpick(0));
+        break;
+    case token("fsin"):
+        state.fpick(0) = std::sin(state.fpick(0));
+        break;
+    case token("fcos"):
+        state.fpick(0) = std::cos(state.fpick(0));
+        break;
+    case token("fatan2"): // ( F: y x -- r )
+        {
+        const auto f = state.fpop();
+        state.fpick(0) = std::atan2(state.fpick(0), f);
+        }
+        break;
+    case token("floor"):
+        state.fpick(0) = std::floor(state.fpick(0));
+        break;
+    case token("fround"):
+        state.fpick(0) = std::nearbyint(state.fpick(0));
+        break;
+    case token("f@"): // ( addr -- ) ( F: -- r )
+        state.fpush(readFloat(state.dict, static_cast<Addr>(state.pop())));
+        break;
+    case token("f!"): // ( addr -- ) ( F: r -- )
+        writeFloat(state.dict, static_cast<Addr>(state.pop()), state.fpop());
+        break;
+    case token("f."):
+        {
+        char buf[32];
+        auto end = std::to_chars(buf, buf + sizeof(buf) - 1, state.fpop()).ptr;
+        *end++ = ' ';
+        state.output({buf, end});
+        }
+        break;
+    case token(">float"): // ( addr u -- flag ) ( F: -- r | )
+        {
+        char buf[32];
+        cell = state.pop();
+        auto addr = static_cast<Addr>(state.pop());
+        Float f = 0;
+
+        // A string of blanks is zero.
+        while (cell > 0 && state.dict.readbyte(static_cast<Addr>(addr + cell - 1)) == ' ')
+            --cell;
+        bool ok = cell <= static_cast<Cell>(sizeof(buf));
+        for (Cell i = 0; ok && i < cell; ++i)
+            buf[i] = static_cast<char>(state.dict.readbyte(addr++));
+        ok = ok && (cell == 0 || Parser::toFloat(buf, static_cast<std::size_t>(cell), f));
+
+        if (ok)
+            state.fpush(f);
+        state.push(ok ? -1 : 0);
+        }
+        break;
+    case token("d>f"):
+        state.fpush(static_cast<Float>(popd(state)));
+        break;
+    case token("f>d"):
+        pushd(state, static_cast<DoubleCell>(state.fpop()));
+        break;
+    case token("f0="):
+        state.push(state.fpop() == 0 ? -1 : 0);
+        break;
+    case token("f<"):
+        {
+        const auto f = state.fpop();
+        state.push(state.fpop() < f ? -1 : 0);
+        }
+        break;
+    case token("fdup"):
+        state.fpush(state.fpick(0));
+        break;
+    case token("fdrop"):
+        state.fpop();
+        break;
+    case token("fswap"):
+        std::swap(state.fpick(0), state.fpick(1));
+        break;
+    case token("fover"):
+        state.fpush(state.fpick(1));
+        break;
+    case token("frot"): // ( F: r1 r2 r3 -- r2 r3 r1 )
+        {
+        const auto f = state.fpick(2);
+        state.fpick(2) = state.fpick(1);
+        state.fpick(1) = state.fpick(0);
+        state.fpick(0) = f;
+        }
+        break;
+    case token("fdepth"):
+        state.push(static_cast<Cell>(state.fsize()));
+        break;
+#endif // ALEE_FLOAT
     default: // Compacted literals (WordCount <= ins < Begin).
-        state.push(ins - WordCount);
+        state.push(static_cast<Cell>(index - WordCount));
         break;
     }
 
+#ifdef ALEE_PACKED
+    if (pending != 0) {
+        index = static_cast<Addr>(pending);
+        pending = 0;
+        goto execute;
+    }
+#endif // ALEE_PACKED
+
     ip += sizeof(Cell);
 }
 
@@ -236,6 +887,26 @@ Cell CoreWords::findi(State& state, Word word)
     return findi(word.begin(&state.dict), word.size());
 }
 
+LIBALEE_SECTION
+Cell CoreWords::findi(std::string_view word)
+{
+    return findi(word.begin(), word.size());
+}
+
+LIBALEE_SECTION
+std::string_view CoreWords::name(Cell token)
+{
+    const char *ptr = wordsarr;
+
+    if (token < 0 || token >= WordCount)
+        return {};
+
+    for (; token > 0; --token)
+        ptr += strlen(ptr) + 1;
+
+    return {ptr, strlen(ptr)};
+}
+
 LIBALEE_SECTION
 void find(State& state, Word word)
 {
@@ -253,6 +924,180 @@ void find(State& state, Word word)
     state.push(imm);
 }
 
+/**
+ * Reads the next character from the input source, waiting for more input
+ * if the source is used up.
+ */
+LIBALEE_SECTION
+uint8_t key(State& state)
+{
+    auto& dict = state.dict;
+    const auto addr = static_cast<Addr>(dict.read(Dictionary::Source) +
+                                        dict.read(Dictionary::Input));
+
+    while (dict.readbyte(addr) == '\0')
+        state.input();
+
+    dict.write(Dictionary::Input, dict.read(Dictionary::Input) + 1);
+    return dict.readbyte(addr);
+}
+
+/**
+ * Adds the given character to the beginning of the pictured numeric output
+ * string. The hold area's first byte (at `here`) is the offset to the
+ * string's beginning; see `<#` and `#>`.
+ */
+LIBALEE_SECTION
+void hold(State& state, uint8_t c)
+{
+    const auto here = state.dict.here();
+    const auto off = static_cast<uint8_t>(state.dict.readbyte(here) - 1);
+
+    state.dict.writebyte(here, off);
+    state.dict.writebyte(here + off, c);
+}
+
+/**
+ * Holds the least-significant digit of ud in the current base.
+ * @return ud divided by the current base.
+ */
+LIBALEE_SECTION
+DoubleAddr digit(State& state, DoubleAddr ud)
+{
+    const auto base = static_cast<Addr>(state.dict.read(Dictionary::Base));
+    const auto d = static_cast<uint8_t>(ud % base);
+
+    hold(state, static_cast<uint8_t>(d < 10 ? '0' + d : 'A' + d - 10));
+    return ud / base;
+}
+
+/**
+ * Copies n bytes from src to dst, from higher addresses down if `backward`
+ * is set. An overlapping copy reads back bytes that it has already written,
+ * as `cmove` and `cmove>` specify.
+ */
+LIBALEE_SECTION
+void copy(State& state, Addr dst, Addr src, Addr n, bool backward)
+{
+    auto& dict = state.dict;
+    const auto hazard = backward ? src > dst && src - dst < n
+                                 : dst > src && dst - src < n;
+
+    if (!hazard) {
+        auto d = dict.contiguous(dst, n);
+        auto s = dict.contiguous(src, n);
+
+        if (d && s) {
+            if (backward)
+                std::copy_backward(s, s + n, d + n);
+            else
+                std::copy(s, s + n, d);
+            return;
+        }
+    }
+
+    if (backward) {
+        while (n-- > 0) {
+            dict.writebyte(static_cast<Addr>(dst + n),
+                dict.readbyte(static_cast<Addr>(src + n)));
+        }
+    } else {
+        for (Addr i = 0; i < n; ++i) {
+            dict.writebyte(static_cast<Addr>(dst + i),
+                dict.readbyte(static_cast<Addr>(src + i)));
+        }
+    }
+}
+
+/**
+ * Compares two strings byte by byte.
+ * @return -1, 0 or 1 as the first string is less than, equal to or greater
+ * than the second.
+ */
+LIBALEE_SECTION
+Cell compare(State& state, Addr a1, Addr u1, Addr a2, Addr u2)
+{
+    auto& dict = state.dict;
+    std::strong_ordering r = std::strong_ordering::equal;
+
+    if (auto p1 = dict.contiguous(a1, u1), p2 = dict.contiguous(a2, u2); p1 && p2) {
+        r = std::lexicographical_compare_three_way(p1, p1 + u1, p2, p2 + u2);
+    } else {
+        const auto n = std::min(u1, u2);
+        for (Addr i = 0; r == 0 && i < n; ++i) {
+            r = dict.readbyte(static_cast<Addr>(a1 + i)) <=>
+                dict.readbyte(static_cast<Addr>(a2 + i));
+        }
+
+        if (r == 0)
+            r = u1 <=> u2;
+    }
+
+    return r < 0 ? -1 : (r > 0 ? 1 : 0);
+}
+
+/**
+ * Searches the first string for the second.
+ * @return The offset of the first match or -1 if there is none.
+ */
+LIBALEE_SECTION
+Cell search(State& state, Addr a1, Addr u1, Addr a2, Addr u2)
+{
+    auto& dict = state.dict;
+
+    if (u2 > u1)
+        return -1;
+
+    if (auto p1 = dict.contiguous(a1, u1), p2 = dict.contiguous(a2, u2); p1 && p2) {
+        const auto p = std::search(p1, p1 + u1, p2, p2 + u2);
+        return p != p1 + u1 || u2 == 0 ? static_cast<Cell>(p - p1) : -1;
+    }
+
+    for (Addr i = 0; i <= u1 - u2; ++i) {
+        Addr j = 0;
+        while (j < u2 && dict.readbyte(static_cast<Addr>(a1 + i + j)) ==
+                         dict.readbyte(static_cast<Addr>(a2 + j)))
+        {
+            ++j;
+        }
+
+        if (j == u2)
+            return static_cast<Cell>(i);
+    }
+
+    return -1;
+}
+
+#ifdef ALEE_FLOAT
+/**
+ * Reads the float stored in the cells at the given address.
+ */
+LIBALEE_SECTION
+Float readFloat(Dictionary& dict, Addr addr)
+{
+    std::array<Cell, sizeof(Float) / sizeof(Cell)> bits;
+
+    for (auto& c : bits) {
+        c = dict.read(addr);
+        addr += sizeof(Cell);
+    }
+
+    return std::bit_cast<Float>(bits);
+}
+
+/**
+ * Stores the given float into the cells at the given address.
+ */
+LIBALEE_SECTION
+void writeFloat(Dictionary& dict, Addr addr, Float f)
+{
+    for (auto c : std::bit_cast<std::array<Cell, sizeof(Float) / sizeof(Cell)>>(f)) {
+        dict.write(addr, c);
+        addr += sizeof(Cell);
+    }
+}
+#endif // ALEE_FLOAT
+
 DoubleCell popd(State& s)
 {
     DoubleCell dcell = s.pop();
@@ -267,3 +1112,229 @@ void pushd(State& s, DoubleCell d)
     s.push(static_cast<Cell>(d >> (sizeof(Cell) * 8)));
 }
 
+
+/**
+ * Outputs the given number in decimal.
+ */
+LIBALEE_SECTION
+static void print(State& state, DoubleCell n)
+{
+    char buf[12];
+    auto ptr = buf + sizeof(buf);
+    auto u = static_cast<DoubleAddr>(n < 0 ? -n : n);
+
+    do {
+        *--ptr = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+
+    if (n < 0)
+        *--ptr = '-';
+
+    state.output({ptr, static_cast<std::size_t>(buf + sizeof(buf) - ptr)});
+}
+
+/**
+ * Outputs the name of the given dictionary entry.
+ */
+LIBALEE_SECTION
+static void printName(State& state, Addr entry)
+{
+    auto word = state.dict.name(entry);
+
+    for (auto it = word.begin(&state.dict); it != word.end(&state.dict); ++it)
+        state.output(static_cast<char>(*it));
+}
+
+/**
+ * Outputs a call to the given address: the called word's name and the
+ * offset into its definition, if not zero.
+ */
+LIBALEE_SECTION
+static void printCall(State& state, Addr addr)
+{
+    if (const auto entry = state.dict.header(addr); entry != 0) {
+        printName(state, entry);
+
+        if (const auto xt = state.dict.getexec(entry); xt != addr) {
+            state.output('+');
+            print(state, addr - xt);
+        }
+    } else {
+        print(state, addr);
+    }
+}
+
+/**
+ * Prints the compiled contents of the given definition, one instruction per
+ * line with its address. Decoding ends at the `exit` that follows every jump
+ * target seen so far; data skipped by a forward `_jmp` (e.g. from `s"`) is
+ * only counted.
+ */
+LIBALEE_SECTION
+void see(State& state, Addr xt)
+{
+    constexpr unsigned MaxTargets = 32;
+    auto& dict = state.dict;
+
+    if (xt < Dictionary::Begin) {
+        state.output(CoreWords::name(xt));
+        state.output(" is a core word\n");
+        return;
+    }
+
+    const auto entry = dict.header(xt);
+    const auto code = dict.read(xt);
+    const auto data = dict.read(static_cast<Addr>(xt + sizeof(Cell) * 2));
+    bool colon = false;
+
+    // Words with a code field are shown as they were defined.
+    switch (code) {
+    case CoreWords::token("_dovar"):
+    case CoreWords::token("_dodoes"):
+        state.output("create ");
+        break;
+    case CoreWords::token("_doconst"):
+    case CoreWords::token("_dovalue"):
+        print(state, data);
+        state.output(code == CoreWords::token("_doconst") ? " constant " : " value ");
+        break;
+    case CoreWords::token("_dodefer"):
+        state.output("defer ");
+        break;
+    default:
+        state.output(": ");
+        colon = true;
+        break;
+    }
+
+    if (entry != 0)
+        printName(state, entry);
+
+    if (code == CoreWords::token("_dodoes")) {
+        state.output(" does> ");
+        printCall(state, static_cast<Addr>(dict.read(static_cast<Addr>(xt + sizeof(Cell)))));
+    } else if (code == CoreWords::token("_dodefer")) {
+        state.output(" ( is ");
+        if (static_cast<Addr>(data) < Dictionary::Begin)
+            state.output(CoreWords::name(data));
+        else
+            printCall(state, static_cast<Addr>(data));
+        state.output(" )");
+    }
+
+    state.output('\n');
+
+    if (!colon)
+        return;
+
+    Addr targets[MaxTargets];
+    unsigned ntargets = 0;
+    Addr reach = xt;
+
+    for (Addr ip = xt; ip < dict.here();) {
+        const auto ins = dict.read(ip);
+        auto next = static_cast<Addr>(ip + sizeof(Cell));
+
+        state.output("  ");
+        print(state, ip);
+        state.output("  ");
+
+#ifdef ALEE_PACKED
+        if (CoreWords::packed(ins)) {
+            for (const auto half : {CoreWords::first(ins), CoreWords::second(ins)}) {
+                if (half >= CoreWords::WordCount)
+                    print(state, half - CoreWords::WordCount);
+                else
+                    state.output(CoreWords::name(half));
+                state.output(' ');
+            }
+
+            state.output('\n');
+            ip = next;
+            continue;
+        }
+#endif // ALEE_PACKED
+
+        if (static_cast<Addr>(ins) >= Dictionary::Begin) {
+            printCall(state, static_cast<Addr>(ins));
+        } else if (ins >= CoreWords::WordCount) {
+            print(state, ins - CoreWords::WordCount);
+        } else if (ins < 0) {
+            state.output("? ");
+            print(state, ins);
+        } else {
+            state.output(CoreWords::name(ins));
+            next = static_cast<Addr>(next + CoreWords::operands(ins) * sizeof(Cell));
+
+            const auto operand = dict.read(static_cast<Addr>(ip + sizeof(Cell)));
+
+            switch (ins) {
+            case CoreWords::token("_jmp0"):
+            case CoreWords::token("_jmp"):
+            case CoreWords::token("_do"):
+            case CoreWords::token("_loop"):
+            case CoreWords::token("_+loop"):
+                {
+                // `leave` continues after the cell that `_do` points to.
+                const auto target = static_cast<Addr>(operand +
+                    (ins == CoreWords::token("_do") ? sizeof(Cell) : 0));
+                state.output(" -> ");
+                print(state, target);
+
+                const bool skip = ins == CoreWords::token("_jmp") &&
+                    target > next &&
+                    std::find(targets, targets + ntargets, next) == targets + ntargets;
+
+                if (skip) {
+                    // Nothing jumps to what follows, so it must be data.
+                    state.output(" ( ");
+                    print(state, target - next);
+                    state.output(" bytes of data )");
+                    next = target;
+                } else if (ntargets < MaxTargets) {
+                    targets[ntargets++] = target;
+                }
+
+                reach = std::max(reach, target);
+                }
+                break;
+#ifdef ALEE_FLOAT
+            case CoreWords::token("_flit"):
+                {
+                char buf[32];
+                auto end = std::to_chars(buf, buf + sizeof(buf),
+                    readFloat(dict, static_cast<Addr>(ip + sizeof(Cell)))).ptr;
+                state.output(' ');
+                state.output({buf, static_cast<std::size_t>(end - buf)});
+                }
+                break;
+#endif // ALEE_FLOAT
+            case CoreWords::token("_locals"):
+                state.output(' ');
+                print(state, operand & 0xFF);
+                state.output(" init ");
+                print(state, (operand >> 8) & 0xFF);
+                break;
+            default:
+                if (CoreWords::operands(ins) > 0) {
+                    state.output(' ');
+                    print(state, operand);
+                }
+                break;
+            }
+        }
+
+        state.output('\n');
+
+        if (ins == CoreWords::token("exit") && ip >= reach)
+            break;
+
+        ip = next;
+    }
+
+    state.output(';');
+    if (entry != 0 && (dict.read(entry) & Dictionary::Immediate))
+        state.output(" immediate");
+    state.output('\n');
+}
@@ -26,6 +26,7 @@
 #include "types.hpp"
 
 #include <algorithm>
+#include <string_view>
 
 class State;
 
@@ -52,6 +53,14 @@ public:
      */
     static Cell findi(State& state, Word word);
 
+    /**
+     * Searches for the token/index of the given host-stored word if it is
+     * part of the fundamental word-set.
+     * @param word The word to look up.
+     * @return The token/index of the word or -1 if not found.
+     */
+    static Cell findi(std::string_view word);
+
     /**
      * Looks up the token/index of the given fundamental word.
      * Primarily used for compile-time lookup.
@@ -62,6 +71,20 @@ public:
         return findi(word, strlen(word));
     }
 
+    /**
+     * Returns the name of the given fundamental word.
+     * @param token The token/index of the word.
+     * @return The word's name or an empty string if token is not a word.
+     */
+    static std::string_view name(Cell token);
+
+    /**
+     * Returns the number of cells of operands that follow the given
+     * fundamental word when it is compiled.
+     * @param token The token/index of the word.
+     */
+    constexpr static unsigned operands(Cell token);
+
     /**
      * Executes the given execution token using the given state.
      * @param token Any valid execution token (word, fundamental, constant...).
@@ -78,10 +101,33 @@ public:
         "+\0-\0m*\0_/\0_%\0"
         "_@\0_!\0>r\0r>\0=\0"
         "<\0&\0|\0^\0"
-        "<<\0>>\0:\0_'\0execute\0"
+        "<<\0>>\0:\0?:\0_'\0execute\0"
         "exit\0;\0_jmp0\0_jmp\0"
         "depth\0_rdepth\0_in\0_ev\0find\0"
-        "_uma\0u<\0um/mod\0";
+        "key\0word\0parse\0parse-name\0>number\0accept\0"
+        "_uma\0u<\0um/mod\0sm/rem\0fm/mod\0emit\0type\0"
+        "d+\0d-\0dnegate\0d<\0du<\0m+\0m*/\0"
+        "hold\0#\0#s\0"
+        "_do\0_loop\0_+loop\0i\0j\0unloop\0"
+        "move\0fill\0cmove\0cmove>\0compare\0search\0-trailing\0"
+        "allocate\0free\0resize\0"
+        "search-wordlist\0index-wordlist\0_see\0name>string\0"
+        "_{:\0_locals\0_local@\0_local!\0_unlocals\0_lfind\0"
+        "_jmp0,\0_dovar\0_doconst\0_dovalue\0_dodefer\0_dodoes\0"
+        "_jmptab\0_endcase,\0"
+#ifdef ALEE_STACK_WORDS
+        "over\0rot\0-rot\0nip\0tuck\0" "2dup\0" "2swap\0"
+#endif // ALEE_STACK_WORDS
+#ifdef ALEE_MATH_WORDS
+        "0=\0" "0<\0" "1+\0negate\0invert\0cells\0min\0max\0abs\0"
+#endif // ALEE_MATH_WORDS
+#ifdef ALEE_FLOAT
+        "_flit\0f+\0f-\0f*\0f/\0fnegate\0fabs\0fsqrt\0f**\0"
+        "fexp\0fln\0fsin\0fcos\0fatan2\0floor\0fround\0"
+        "f@\0f!\0f.\0>float\0d>f\0f>d\0f0=\0f<\0"
+        "fdup\0fdrop\0fswap\0fover\0frot\0fdepth\0"
+#endif // ALEE_FLOAT
+        ;
 
     /**
      * Count of total fundamental words.
@@ -89,6 +135,52 @@ public:
     constexpr static Cell WordCount = [] {
         return std::count(wordsarr, wordsarr + sizeof(wordsarr), '\0'); }();
 
+    static_assert(WordCount < Dictionary::Begin,
+        "Opcodes must not overlap with dictionary addresses");
+
+#ifdef ALEE_PACKED
+    /**
+     * Tokens below this fit in half of a packed cell: the fundamental words
+     * and the smallest compacted literals.
+     */
+    constexpr static Cell ShortCount = 128;
+
+    static_assert(WordCount < ShortCount,
+        "Opcodes must fit in half of a packed cell");
+    static_assert(Dictionary::Begin <= (1 << 9) + 1,
+        "Packed cells must not overlap with opcodes or literals");
+
+    /**
+     * Returns true if the given cell holds two packed tokens. Packed cells
+     * are odd, so they never collide with the (aligned) address of a call.
+     */
+    constexpr static bool packed(Cell ins) {
+        return (ins & 1) && static_cast<Addr>(ins) >= Dictionary::Begin;
+    }
+
+    /** Packs two short tokens into a cell; first is executed first. */
+    constexpr static Cell pack(Cell first, Cell second) {
+        return static_cast<Cell>(static_cast<Addr>(first << 9 | second << 2 | 1));
+    }
+
+    /** Returns the first token of a packed cell. */
+    constexpr static Cell first(Cell ins) {
+        return static_cast<Cell>((static_cast<Addr>(ins) >> 9) & 0x7F);
+    }
+
+    /** Returns the second token of a packed cell. */
+    constexpr static Cell second(Cell ins) {
+        return static_cast<Cell>((static_cast<Addr>(ins) >> 2) & 0x7F);
+    }
+
+    /**
+     * Returns true if the given token may be packed: a short literal, or a
+     * word that takes no operands and does not change the instruction
+     * pointer.
+     */
+    constexpr static bool packable(Cell token);
+#endif // ALEE_PACKED
+
 private:
     /**
      * Generic implementation of findi(). Private; use public implementations.
@@ -115,5 +207,69 @@ private:
     }
 };
 
+LIBALEE_SECTION
+constexpr unsigned CoreWords::operands(Cell token)
+{
+    switch (token) {
+    case CoreWords::token("_lit"):
+    case CoreWords::token("_jmp0"):
+    case CoreWords::token("_jmp"):
+    case CoreWords::token("_do"):
+    case CoreWords::token("_loop"):
+    case CoreWords::token("_+loop"):
+    case CoreWords::token("_locals"):
+    case CoreWords::token("_local@"):
+    case CoreWords::token("_local!"):
+    case CoreWords::token("_dodoes"):
+    case CoreWords::token("_jmptab"):
+        return 1;
+#ifdef ALEE_FLOAT
+    case CoreWords::token("_flit"):
+        return sizeof(Float) / sizeof(Cell);
+#endif // ALEE_FLOAT
+    default:
+        return 0;
+    }
+}
+
+#ifdef ALEE_PACKED
+LIBALEE_SECTION
+constexpr bool CoreWords::packable(Cell token)
+{
+    switch (token) {
+    case CoreWords::token("drop"):
+    case CoreWords::token("dup"):
+    case CoreWords::token("swap"):
+    case CoreWords::token("pick"):
+    case CoreWords::token("+"):
+    case CoreWords::token("-"):
+    case CoreWords::token("m*"):
+    case CoreWords::token("_/"):
+    case CoreWords::token("_%"):
+    case CoreWords::token("_@"):
+    case CoreWords::token("_!"):
+    case CoreWords::token(">r"):
+    case CoreWords::token("r>"):
+    case CoreWords::token("="):
+    case CoreWords::token("<"):
+    case CoreWords::token("&"):
+    case CoreWords::token("|"):
+    case CoreWords::token("^"):
+    case CoreWords::token("<<"):
+    case CoreWords::token(">>"):
+    case CoreWords::token("depth"):
+    case CoreWords::token("_rdepth"):
+    case CoreWords::token("_uma"):
+    case CoreWords::token("u<"):
+    case CoreWords::token("um/mod"):
+    case CoreWords::token("i"):
+    case CoreWords::token("j"):
+        return true;
+    default:
+        return token >= WordCount && token < ShortCount;
+    }
+}
+#endif // ALEE_PACKED
+
 #endif // ALEEFORTH_COREWORDS_HPP
 
@@ -22,10 +22,27 @@ LIBALEE_SECTION
 void Dictionary::initialize()
 {
     write(Base, 10);
-    write(Here, Begin);
+    write(Here, Begin + HeaderSpace);
     write(Latest, Begin);
     write(Compiling, 0);
+    write(Locals, 0);
+    write(Forth, 0);
+    write(Forth + sizeof(Cell), 0);
+    write(Current, Forth);
+    write(Order, 1);
+    write(Order + sizeof(Cell), Forth);
+    write(Fold, 0);
+    write(Names, Begin);
     write(Source, Input + sizeof(Cell));
+    initializeHeap();
+}
+
+LIBALEE_SECTION
+void Dictionary::initializeHeap() noexcept
+{
+    // Empty heap: no lowest block and no free lists.
+    for (Addr i = 0; i <= HeapClasses; ++i)
+        write(static_cast<Addr>(heapTop() + i * sizeof(Cell)), 0);
 }
 
 LIBALEE_SECTION
@@ -34,7 +51,7 @@ Addr Dictionary::allot(Cell amount) noexcept
     Addr old = here();
     decltype(capacity()) neww = old + amount;
 
-    if (neww < capacity()) {
+    if (neww < heapBottom()) {
         write(Here, static_cast<Addr>(neww));
     } else {
         // TODO how to handle allot failure? Error code?
@@ -43,6 +60,120 @@ Addr Dictionary::allot(Cell amount) noexcept
     return old;
 }
 
+LIBALEE_SECTION
+Addr Dictionary::heapTop() const noexcept
+{
+    constexpr unsigned long int AddrSpace = 1ul << (sizeof(Addr) * 8);
+    const auto top = std::min(capacity(), AddrSpace);
+
+    // Aligned down, since the capacity may be odd.
+    return static_cast<Addr>((top - (HeapClasses + 1) * sizeof(Cell)) & ~(sizeof(Cell) - 1));
+}
+
+LIBALEE_SECTION
+Addr Dictionary::heapBottom() const noexcept
+{
+    const auto bottom = static_cast<Addr>(read(heapTop()));
+    return bottom != 0 ? bottom : heapTop();
+}
+
+LIBALEE_SECTION
+Addr Dictionary::allocate(Addr size) noexcept
+{
+    Cell cls = 0;
+    while (blockSize(cls) - sizeof(Cell) < size) {
+        if (++cls == HeapClasses)
+            return 0;
+    }
+
+    const Addr head = static_cast<Addr>(heapTop() + (cls + 1) * sizeof(Cell));
+    auto block = static_cast<Addr>(read(head));
+
+    if (block != 0) {
+        // Reuse a freed block, its first data cell links to the next one.
+        write(head, read(static_cast<Addr>(block + sizeof(Cell))));
+    } else {
+        const auto bottom = heapBottom();
+        if (bottom - here() < blockSize(cls))
+            return 0;
+
+        block = static_cast<Addr>(bottom - blockSize(cls));
+        write(heapTop(), static_cast<Cell>(block));
+    }
+
+    write(block, cls);
+    return static_cast<Addr>(block + sizeof(Cell));
+}
+
+LIBALEE_SECTION
+Cell Dictionary::blockClass(Addr addr) const noexcept
+{
+    const auto block = static_cast<Addr>(addr - sizeof(Cell));
+
+    if (block < heapBottom() || block >= heapTop() || block % sizeof(Cell) != 0)
+        return FreeBlock;
+
+    const auto cls = read(block);
+    if (cls < 0 || cls >= static_cast<Cell>(HeapClasses) ||
+        block + static_cast<unsigned long int>(blockSize(cls)) > heapTop())
+    {
+        return FreeBlock;
+    }
+
+    return cls;
+}
+
+LIBALEE_SECTION
+bool Dictionary::deallocate(Addr addr) noexcept
+{
+    const auto block = static_cast<Addr>(addr - sizeof(Cell));
+    const auto cls = blockClass(addr);
+
+    if (cls == FreeBlock)
+        return false;
+
+    // Marks the block as free so that freeing it again is refused.
+    write(block, FreeBlock);
+
+    if (block == heapBottom()) {
+        // Give the lowest block back to `here`.
+        write(heapTop(), static_cast<Cell>(block + blockSize(cls)));
+    } else {
+        const Addr head = static_cast<Addr>(heapTop() + (cls + 1) * sizeof(Cell));
+        write(addr, read(head));
+        write(head, static_cast<Cell>(block));
+    }
+
+    return true;
+}
+
+LIBALEE_SECTION
+Addr Dictionary::reallocate(Addr addr, Addr size) noexcept
+{
+    if (addr == 0)
+        return allocate(size);
+
+    const auto cls = blockClass(addr);
+    if (cls == FreeBlock)
+        return 0;
+
+    const auto oldsize = static_cast<Addr>(blockSize(cls) - sizeof(Cell));
+    if (size <= oldsize)
+        return addr;
+
+    const auto newaddr = allocate(size);
+    if (newaddr != 0) {
+        for (Addr i = 0; i < oldsize; i += sizeof(Cell)) {
+            write(static_cast<Addr>(newaddr + i),
+                read(static_cast<Addr>(addr + i)));
+        }
+
+        deallocate(addr);
+    }
+
+    return newaddr;
+}
+
 LIBALEE_SECTION
 void Dictionary::add(Cell value) noexcept
 {
@@ -63,56 +194,355 @@ Addr Dictionary::alignhere() noexcept
 }
 
 LIBALEE_SECTION
-void Dictionary::addDefinition(Word word) noexcept
+Addr Dictionary::addDefinition(Word word) noexcept
 {
-    Cell wsize = word.size();
-    add(wsize);
+    const auto head = static_cast<Addr>(read(read(Current)));
+    const Cell wsize = word.size();
+    auto entry = alignhere();
 
-    if (alignhere() - latest() >= MaxDistance)
-        add(0);
+    if constexpr (HeaderSpace > 0) {
+        // Allow for a long distance when checking that the entry fits.
+        const auto names = static_cast<Addr>(read(Names));
+        const auto size = aligned(static_cast<Addr>(3 * sizeof(Cell) + wsize));
+
+        if (Begin + HeaderSpace - names >= size) {
+            entry = names;
+        } else {
+            // Later entries must follow this one, so the space is closed.
+            write(Names, Begin + HeaderSpace);
+        }
+    }
+
+    write(entry, wsize);
+    auto addr = static_cast<Addr>(entry + sizeof(Cell));
+
+    // Room for a "long" distance, see link().
+    if (head != 0 && entry - head >= MaxDistance) {
+        write(addr, 0);
+        addr += sizeof(Cell);
+    }
+
+    // Room for the execution token, known once the entry is placed.
+    const auto xt = addr;
+    if constexpr (HeaderSpace > 0)
+        addr += sizeof(Cell);
 
-    auto addr = allot(wsize);
     auto it = word.begin(this);
     const auto end = word.end(this);
 
     while (it != end)
         writebyte(addr++, *it++);
 
-    alignhere();
+    if (entry == here())
+        allot(static_cast<Cell>(aligned(addr) - entry));
+    else
+        write(Names, static_cast<Cell>(aligned(addr)));
+
+    if constexpr (HeaderSpace > 0)
+        write(xt, static_cast<Cell>(here()));
+
+    return entry;
 }
 
 LIBALEE_SECTION
-Addr Dictionary::find(Word word) noexcept
+void Dictionary::link(Addr addr) noexcept
 {
-    Addr lt = latest();
+    latest(addr);
+    if ((read(addr) & 0x1F) == 0)
+        return;
+
+    const auto wid = static_cast<Addr>(read(Current));
+    const auto head = static_cast<Addr>(read(wid));
+    Addr dist = head != 0 ? static_cast<Addr>(addr - head) : 0;
+
+    if (dist >= MaxDistance) {
+        // Large distance to previous entry: store in dedicated cell.
+        write(static_cast<Addr>(addr + sizeof(Cell)), static_cast<Cell>(dist));
+        dist = MaxDistance;
+    }
 
-    for (;;) {
-        const Addr l = read(lt);
-        const Addr len = l & 0x1F;
-        Word lw;
+    write(addr, static_cast<Cell>((read(addr) & 0x1F) | dist << 6));
+    write(wid, static_cast<Cell>(addr));
 
-        if ((l >> 6) < MaxDistance) {
-            lw = Word::fromLength(lt + sizeof(Cell), len);
-            if (equal(word, lw))
-                return lt;
-            else if (lt == Begin)
-                break;
-            else
-                lt -= l >> 6;
+    if (const auto table = static_cast<Addr>(read(wid + sizeof(Cell))); table != 0) {
+        const auto mask = static_cast<Addr>(read(table + sizeof(Cell)));
+        const auto count = static_cast<Addr>(read(table + 2 * sizeof(Cell)));
+
+        // Keep the index at most half full.
+        if (static_cast<Addr>(read(table)) == head && count < mask / 2) {
+            insert(table, addr, true);
+            write(table, static_cast<Cell>(addr));
         } else {
-            lw = Word::fromLength(lt + 2 * sizeof(Cell), len);
-            if (equal(word, lw))
+            index(wid);
+        }
+    }
+}
+
+LIBALEE_SECTION
+Word Dictionary::name(Addr addr) const noexcept
+{
+    const Addr l = read(addr);
+    const Addr len = l & 0x1F;
+
+    addr += sizeof(Cell);
+    if ((l >> 6) == MaxDistance)
+        addr += sizeof(Cell);
+    if constexpr (HeaderSpace > 0)
+        addr += sizeof(Cell);
+
+    return Word::fromLength(addr, len);
+}
+
+LIBALEE_SECTION
+Addr Dictionary::next(Addr addr) const noexcept
+{
+    const Addr l = read(addr);
+
+    if ((l >> 6) < MaxDistance)
+        return l >> 6;
+    else
+        return static_cast<Addr>(read(static_cast<Addr>(addr + sizeof(Cell))));
+}
+
+template<typename Pred>
+LIBALEE_SECTION
+Addr Dictionary::findif(Addr wid, Addr h, Pred match) noexcept
+{
+    Addr lt = static_cast<Addr>(read(wid));
+    auto table = static_cast<Addr>(read(wid + sizeof(Cell)));
+
+    if (table != 0 && static_cast<Addr>(read(table)) != lt) {
+        // The wordlist changed beneath its index, e.g. by a marker.
+        index(wid);
+        table = static_cast<Addr>(read(wid + sizeof(Cell)));
+    }
+
+    if (table != 0) {
+        const auto mask = static_cast<Addr>(read(table + sizeof(Cell)));
+        const auto slots = static_cast<Addr>(table + 3 * sizeof(Cell));
+
+        for (auto i = static_cast<Addr>(h & mask);; i = (i + 1) & mask) {
+            lt = static_cast<Addr>(read(static_cast<Addr>(slots + i * sizeof(Cell))));
+            if (lt == 0 || match(name(lt)))
                 return lt;
-            else if (lt == Begin)
-                break;
-            else
-                lt -= static_cast<Addr>(read(lt + sizeof(Cell)));
         }
     }
 
+    while (lt != 0) {
+        if (match(name(lt)))
+            return lt;
+
+        const auto dist = next(lt);
+        lt = dist != 0 ? static_cast<Addr>(lt - dist) : 0;
+    }
+
     return 0;
 }
 
+LIBALEE_SECTION
+Addr Dictionary::find(Word word) noexcept
+{
+    const auto h = hash(word.begin(this), word.end(this));
+    const auto count = read(Order);
+
+    for (Cell i = 1; i <= count; ++i) {
+        const auto wid = static_cast<Addr>(read(static_cast<Addr>(Order + i * sizeof(Cell))));
+        if (auto lt = findif(wid, h, [this, word](Word lw) { return equal(word, lw); }); lt)
+            return lt;
+    }
+
+    return 0;
+}
+
+LIBALEE_SECTION
+Addr Dictionary::find(Addr wid, Word word) noexcept
+{
+    const auto h = hash(word.begin(this), word.end(this));
+    return findif(wid, h, [this, word](Word lw) { return equal(word, lw); });
+}
+
+LIBALEE_SECTION
+Addr Dictionary::find(const char *word, unsigned len) noexcept
+{
+    const auto h = hash(word, word + len);
+    const auto count = read(Order);
+
+    for (Cell i = 1; i <= count; ++i) {
+        const auto wid = static_cast<Addr>(read(static_cast<Addr>(Order + i * sizeof(Cell))));
+        if (auto lt = findif(wid, h, [this, word, len](Word lw) { return equal(lw, word, len); }); lt)
+            return lt;
+    }
+
+    return 0;
+}
+
+LIBALEE_SECTION
+Addr Dictionary::header(Addr addr) noexcept
+{
+    const auto count = read(Order);
+    Addr best = 0;
+
+    for (Cell i = 0; i <= count; ++i) {
+        const auto wid = static_cast<Addr>(read(static_cast<Addr>(
+            i == 0 ? Current : Order + i * sizeof(Cell))));
+
+        for (auto lt = static_cast<Addr>(read(wid)); lt != 0;) {
+            if (lt > best && getexec(lt) <= addr)
+                best = lt;
+
+            const auto dist = next(lt);
+            lt = dist != 0 ? static_cast<Addr>(lt - dist) : 0;
+        }
+    }
+
+    return best;
+}
+
+LIBALEE_SECTION
+bool Dictionary::index(Addr wid) noexcept
+{
+    const auto head = static_cast<Addr>(read(wid));
+
+    if (auto old = static_cast<Addr>(read(wid + sizeof(Cell))); old != 0) {
+        deallocate(old);
+        write(wid + sizeof(Cell), 0);
+    }
+
+    Addr count = 0;
+    for (Addr lt = head; lt != 0; ++count) {
+        const auto dist = next(lt);
+        lt = dist != 0 ? static_cast<Addr>(lt - dist) : 0;
+    }
+
+    // At most half full, so that probing stays short.
+    Addr buckets = 16;
+    while (buckets / 2 <= count) {
+        if (buckets == 8192)
+            return false;
+        buckets = static_cast<Addr>(buckets * 2);
+    }
+
+    const auto table = allocate(static_cast<Addr>((3 + buckets) * sizeof(Cell)));
+    if (table == 0)
+        return false;
+
+    write(table, static_cast<Cell>(head));
+    write(table + sizeof(Cell), static_cast<Cell>(buckets - 1));
+    write(table + 2 * sizeof(Cell), 0);
+    for (Addr i = 0; i < buckets; ++i)
+        write(static_cast<Addr>(table + (3 + i) * sizeof(Cell)), 0);
+
+    // Newest entries first, so that they shadow older ones of the same name.
+    for (Addr lt = head; lt != 0;) {
+        insert(table, lt, false);
+
+        const auto dist = next(lt);
+        lt = dist != 0 ? static_cast<Addr>(lt - dist) : 0;
+    }
+
+    write(wid + sizeof(Cell), static_cast<Cell>(table));
+    return true;
+}
+
+LIBALEE_SECTION
+void Dictionary::insert(Addr table, Addr addr, bool replace) noexcept
+{
+    auto word = name(addr);
+    const auto mask = static_cast<Addr>(read(table + sizeof(Cell)));
+    const auto slots = static_cast<Addr>(table + 3 * sizeof(Cell));
+
+    for (auto i = static_cast<Addr>(hash(word.begin(this), word.end(this)) & mask);;
+         i = (i + 1) & mask)
+    {
+        const auto slot = static_cast<Addr>(slots + i * sizeof(Cell));
+
+        if (const auto lt = static_cast<Addr>(read(slot)); lt == 0) {
+            write(slot, static_cast<Cell>(addr));
+            write(table + 2 * sizeof(Cell), read(table + 2 * sizeof(Cell)) + 1);
+            break;
+        } else if (equal(name(lt), word)) {
+            if (replace)
+                write(slot, static_cast<Cell>(addr));
+            break;
+        }
+    }
+}
+
+LIBALEE_SECTION
+bool Dictionary::addLocal(Word word) noexcept
+{
+    auto table = static_cast<Addr>(read(Locals));
+    Addr end = sizeof(Cell);
+    Cell count = 0;
+
+    if (table != 0) {
+        count = read(table);
+        for (Cell i = 0; i < count; ++i)
+            end = static_cast<Addr>(end + 1 + readbyte(static_cast<Addr>(table + end)));
+    }
+
+    // Local indices must fit in the byte operands of `_locals`.
+    if (count == 0xFF)
+        return false;
+
+    table = reallocate(table, static_cast<Addr>(end + 1 + word.size()));
+    if (table == 0)
+        return false;
+
+    write(Locals, static_cast<Cell>(table));
+    write(table, count + 1);
+
+    auto addr = static_cast<Addr>(table + end);
+    writebyte(addr++, static_cast<uint8_t>(word.size()));
+    for (auto it = word.begin(this); it != word.end(this); ++it)
+        writebyte(addr++, *it);
+
+    return true;
+}
+
+template<typename Pred>
+LIBALEE_SECTION
+Cell Dictionary::findlocalif(Pred match) noexcept
+{
+    const auto table = static_cast<Addr>(read(Locals));
+    if (table == 0)
+        return -1;
+
+    const auto count = read(table);
+    auto addr = static_cast<Addr>(table + sizeof(Cell));
+
+    for (Cell i = 0; i < count; ++i) {
+        const auto len = readbyte(addr);
+        if (match(Word::fromLength(static_cast<Addr>(addr + 1), len)))
+            return i;
+
+        addr = static_cast<Addr>(addr + 1 + len);
+    }
+
+    return -1;
+}
+
+LIBALEE_SECTION
+Cell Dictionary::findLocal(Word word) noexcept
+{
+    return findlocalif([this, word](Word lw) { return equal(word, lw); });
+}
+
+LIBALEE_SECTION
+Cell Dictionary::findLocal(const char *word, unsigned len) noexcept
+{
+    return findlocalif([this, word, len](Word lw) { return equal(lw, word, len); });
+}
+
+LIBALEE_SECTION
+void Dictionary::clearLocals() noexcept
+{
+    if (const auto table = static_cast<Addr>(read(Locals)); table != 0) {
+        deallocate(table);
+        write(Locals, 0);
+    }
+}
+
 LIBALEE_SECTION
 Addr Dictionary::getexec(Addr addr) noexcept
 {
@@ -123,6 +553,9 @@ Addr Dictionary::getexec(Addr addr) noexcept
     if ((l >> 6) == MaxDistance)
         addr += sizeof(Cell);
 
+    if constexpr (HeaderSpace > 0)
+        return static_cast<Addr>(read(addr));
+
     addr += len;
     return aligned(addr);
 }
@@ -132,7 +565,7 @@ bool Dictionary::hasInput() const noexcept
 {
     const Addr src = read(Dictionary::Source);
     const Addr end = read(Dictionary::SourceLen);
-    auto idx = static_cast<uint8_t>(read(Dictionary::Input));
+    auto idx = static_cast<Addr>(read(Dictionary::Input));
 
     while (idx < end) {
         auto ch = readbyte(src + idx);
@@ -151,32 +584,41 @@ bool Dictionary::hasInput() const noexcept
 
 LIBALEE_SECTION
 Word Dictionary::input() noexcept
+{
+    return parse(' ', true);
+}
+
+LIBALEE_SECTION
+Word Dictionary::parse(uint8_t delim, bool skip) noexcept
 {
     const Addr src = read(Dictionary::Source);
     const Addr end = read(Dictionary::SourceLen);
-    auto idx = static_cast<uint8_t>(read(Dictionary::Input));
+    auto idx = static_cast<Addr>(read(Dictionary::Input));
 
-    Addr wstart = src + idx;
-    Addr wend = wstart;
+    const auto isdelim = [delim](uint8_t ch) {
+        return delim == ' ' ? isspace(ch) : ch == delim; };
 
-    while (idx < end) {
-        auto ch = readbyte(wend);
+    while (skip && idx < end && readbyte(src + idx) != '\0' &&
+           isdelim(readbyte(src + idx)))
+    {
+        ++idx;
+    }
+
+    const Addr wstart = src + idx;
 
-        if (isspace(ch)) {
-            if (wend - wstart > 0)
-                break;
+    for (; idx < end; ++idx) {
+        const auto ch = readbyte(src + idx);
 
-            ++wstart;
-        } else if (ch == '\0') {
+        if (ch == '\0') {
             break;
+        } else if (isdelim(ch)) {
+            write(Dictionary::Input, static_cast<Cell>(idx + 1));
+            return Word(wstart, static_cast<Addr>(src + idx));
         }
-
-        ++wend;
-        ++idx;
     }
 
-    writebyte(Dictionary::Input, ++idx);
-    return Word(wstart, wend);
+    write(Dictionary::Input, static_cast<Cell>(idx));
+    return Word(wstart, static_cast<Addr>(src + idx));
 }
 
 LIBALEE_SECTION
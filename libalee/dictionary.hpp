@@ -41,11 +41,37 @@
  *  - One information cell:
  *    - bits 0..4: Length of name
  *    - bit 5: Set if word is immediate
- *    - bits 6..15: Distance (backwards) to the next entry
+ *    - bits 6..15: Distance (backwards) to the next entry in its wordlist,
+ *      or zero for the wordlist's first entry
  *    - If bits 6..15 are all one-bits then "long" distance in following cell.
+ *  - With separate headers (see HeaderSpace), a cell holding the execution
+ *    token of the definition
  *  - "Length" bytes of name
  *  - Zero or more bytes for address alignment
- *  - Zero or more bytes of the definition's contents
+ *  - Zero or more bytes of the definition's contents, unless headers are
+ *    separate
+ *
+ * Defining ALEE_HEADER_SPACE keeps that many bytes after Begin for entries
+ * alone, with definitions compiled after them. Lookups then walk a dense
+ * table of names instead of stepping over code. Entries that no longer fit
+ * are placed with the code as usual.
+ *
+ * Memory from allocate() is carved from the top of the dictionary downwards,
+ * towards `here`. Each block is a power-of-two size class: a cell holding
+ * the class followed by the user's data. Freed blocks have their class
+ * replaced by FreeBlock and go onto a free list for their class, or back to
+ * `here` when lowest. The free list heads and the heap's lowest address are
+ * kept in the dictionary's top cells, where zero means empty.
+ *
+ * A wordlist is identified by the address of two cells: its latest entry
+ * (zero if empty) and its hash index (zero if it has none). An index is a
+ * heap block holding the latest entry it covers, the bucket mask, the count
+ * of names and then an open-addressed table of entries, newest entry per
+ * name. Lookups rebuild an index that no longer matches its wordlist.
+ *
+ * The names of the current definition's locals are kept in a heap block:
+ * a cell holding the count of names followed by each name as a counted
+ * string.
  */
 class Dictionary
 {
@@ -58,18 +84,58 @@ public:
     constexpr static Addr Latest     = sizeof(Cell) * 2;
     /** Stores a boolean indication of compiling state. */
     constexpr static Addr Compiling  = sizeof(Cell) * 3;
-    /** Stores the address of the last execution token determined by colon. */
+    /** Stores the execution token of the definition last begun by colon. */
     constexpr static Addr CompToken  = sizeof(Cell) * 4;
     /** Stores the address of the current interpreter input source. */
     constexpr static Addr Source     = sizeof(Cell) * 5;
     /** Stores the size in bytes of the interpreter input source. */
     constexpr static Addr SourceLen  = sizeof(Cell) * 6;
+    /** Stores the address of the current definition's local names, if any. */
+    constexpr static Addr Locals     = sizeof(Cell) * 7;
+    /** Stores FORTH-WORDLIST: its latest entry then its hash index. */
+    constexpr static Addr Forth      = sizeof(Cell) * 8;
+    /** Stores the wordlist that new definitions are added to. */
+    constexpr static Addr Current    = sizeof(Cell) * 10;
+    /** Stores the search order: its length then wordlists, first searched first. */
+    constexpr static Addr Order      = sizeof(Cell) * 11;
+    /** Stores the maximum length of the search order. */
+    constexpr static Addr OrderSize  = 8;
+    /**
+     * Stores where the code compiled since the parser last executed a word
+     * begins. Only this code may be rewritten by folding and packing.
+     */
+    constexpr static Addr Fold       = sizeof(Cell) * 20;
+    /** Stores where the next entry goes when headers are separate. */
+    constexpr static Addr Names      = sizeof(Cell) * 21;
     /** Stores the dictionary's input buffer (a counted string). */
-    constexpr static Addr Input      = sizeof(Cell) * 7;
-    /** Stores the size of the dictionary's input buffer in bytes. */
+    constexpr static Addr Input      = sizeof(Cell) * 22;
+    /**
+     * Stores the size of the dictionary's input buffer in bytes. Builds with
+     * the floating-point words or the extra word groups have more opcodes,
+     * which must stay below Begin, so they use a larger buffer.
+     */
+#if defined(ALEE_FLOAT) || defined(ALEE_STACK_WORDS) || defined(ALEE_MATH_WORDS)
+    constexpr static Addr InputCells = 128;
+#else
     constexpr static Addr InputCells = 80;
+#endif
     /** Stores the dictionary's "beginning" i.e. where new definitions begin. */
-    constexpr static Addr Begin      = sizeof(Cell) * 8 + InputCells;
+    constexpr static Addr Begin      = sizeof(Cell) * 23 + InputCells;
+
+#ifdef ALEE_HEADER_SPACE
+    /** Size in bytes of the space after Begin that is kept for entries. */
+    constexpr static Addr HeaderSpace = ALEE_HEADER_SPACE;
+#else
+    constexpr static Addr HeaderSpace = 0;
+#endif // ALEE_HEADER_SPACE
+
+    static_assert(HeaderSpace % sizeof(Cell) == 0,
+        "Header space must be a whole number of cells");
+
+    /** Number of heap size classes; class n holds 2^(n+3)-byte blocks. */
+    constexpr static unsigned HeapClasses = 13;
+    /** Class cell value that marks a freed heap block. */
+    constexpr static Cell FreeBlock = -1;
 
     /** "Immediate" marker bit for a word's definition. */
     constexpr static Cell Immediate = (1 << 5);
@@ -91,12 +157,29 @@ public:
     /** Returns the total capacity of the dictionary in bytes. */
     virtual unsigned long int capacity() const noexcept = 0;
 
+    /**
+     * Returns a pointer to the given range of memory if that range is stored
+     * contiguously and writably in host memory, or nullptr if it is not.
+     * Enables bulk operations on the range; by default none are allowed.
+     * @param addr Beginning address of the range.
+     * @param size Size of the range in bytes.
+     */
+    LIBALEE_SECTION
+    virtual uint8_t *contiguous(Addr, Addr) noexcept { return nullptr; }
+
     /**
      * Initializes essential dictionary values.
      * Must be called before dictionary use.
      */
     void initialize();
 
+    /**
+     * Empties the heap by clearing its metadata. Called by initialize();
+     * dictionaries loaded from an image that does not reach the heap's
+     * metadata must call this instead.
+     */
+    void initializeHeap() noexcept;
+
     /**
      * Gets the address stored in `here`.
      */
@@ -148,20 +231,124 @@ public:
      */
     void add(Cell value) noexcept;
 
+    /**
+     * Returns the lowest address used by the heap, which is the limit for
+     * `here`.
+     */
+    Addr heapBottom() const noexcept;
+
+    /**
+     * Allocates a block of memory from the heap.
+     * @param size The number of bytes needed.
+     * @return The address of the block or zero if allocation failed.
+     */
+    Addr allocate(Addr size) noexcept;
+
+    /**
+     * Returns a block given by allocate() to the heap.
+     * @param addr The address of the block.
+     * @return False if addr does not appear to be an allocated block.
+     */
+    bool deallocate(Addr addr) noexcept;
+
+    /**
+     * Changes the size of a block given by allocate(), moving its contents
+     * to a new block if necessary.
+     * @param addr The address of the block.
+     * @param size The number of bytes needed.
+     * @return The address of the resized block or zero if resizing failed,
+     * in which case the original block is left untouched.
+     */
+    Addr reallocate(Addr addr, Addr size) noexcept;
+
     /**
      * Stores the beginning of a new word definition in the dictionary.
      * The word must eventually have its definition concluded via semicolon.
+     * The definition's contents begin at the following `here`.
      * @param word The dictionary-stored name of the new word.
+     * @return The beginning address of the new entry.
+     */
+    Addr addDefinition(Word word) noexcept;
+
+    /**
+     * Links a completed definition into the current wordlist and makes it
+     * the latest definition. Nameless definitions are not linked.
+     * @param addr The beginning address of the definition.
      */
-    void addDefinition(Word word) noexcept;
+    void link(Addr addr) noexcept;
 
     /**
-     * Searches the dictionary for an entry for the given word.
+     * Searches the wordlists of the search order for the given word.
      * @param word The dictionary-stored word to search for.
      * @return The beginning address of the word or zero if not found.
      */
     Addr find(Word word) noexcept;
 
+    /**
+     * Searches the given wordlist for the given word.
+     * @param wid The wordlist to search.
+     * @param word The dictionary-stored word to search for.
+     * @return The beginning address of the word or zero if not found.
+     */
+    Addr find(Addr wid, Word word) noexcept;
+
+    /**
+     * Searches the wordlists of the search order for the given string.
+     * @param word The string to search for; need not be in the dictionary.
+     * @param len The length of the string in bytes.
+     * @return The beginning address of the word or zero if not found.
+     */
+    Addr find(const char *word, unsigned len) noexcept;
+
+    /**
+     * Adds a local of the given name to the current definition.
+     * @param word The dictionary-stored name of the local.
+     * @return False if there was no room for the name.
+     */
+    bool addLocal(Word word) noexcept;
+
+    /**
+     * Searches the current definition's locals for the given word.
+     * @param word The dictionary-stored word to search for.
+     * @return The local's index or -1 if not found.
+     */
+    Cell findLocal(Word word) noexcept;
+
+    /**
+     * Searches the current definition's locals for the given string.
+     * @param word The string to search for; need not be in the dictionary.
+     * @param len The length of the string in bytes.
+     * @return The local's index or -1 if not found.
+     */
+    Cell findLocal(const char *word, unsigned len) noexcept;
+
+    /**
+     * Forgets the current definition's locals.
+     */
+    void clearLocals() noexcept;
+
+    /**
+     * Returns the name of the given dictionary entry.
+     * @param addr The beginning address of a defined word.
+     */
+    Word name(Addr addr) const noexcept;
+
+    /**
+     * Finds the entry whose definition contains the given address, searching
+     * the wordlists of the search order and the current wordlist.
+     * @param addr The address to look up, e.g. an execution token.
+     * @return The beginning address of the entry or zero if not found.
+     */
+    Addr header(Addr addr) noexcept;
+
+    /**
+     * Builds or rebuilds a hash index for the given wordlist, which will be
+     * kept up to date as definitions are added.
+     * @param wid The wordlist to index.
+     * @return False if there was no room for the index.
+     */
+    bool index(Addr wid) noexcept;
+
     /**
      * Produces the execution token for the given dictionary entry.
      * @param addr The beginning address of a defined word.
@@ -176,6 +363,15 @@ public:
      */
     Word input() noexcept;
 
+    /**
+     * Reads text from the input buffer up to the given delimiter, which is
+     * consumed if it is found.
+     * @param delim The delimiter; a space stands for any whitespace.
+     * @param skip True to first skip over leading delimiters.
+     * @return The text read, which is empty if none is available.
+     */
+    Word parse(uint8_t delim, bool skip) noexcept;
+
     /**
      * Returns true if the dictionary's input buffer has  immediately available
      * data.
@@ -212,6 +408,72 @@ public:
     virtual ~Dictionary() {};
 
 private:
+    /**
+     * Returns the address of the heap's metadata: the heap's lowest address
+     * followed by the free list head for each size class.
+     */
+    Addr heapTop() const noexcept;
+
+    /**
+     * Returns the size class of the block given by allocate() at the given
+     * address, or FreeBlock if addr is not an allocated block.
+     */
+    Cell blockClass(Addr addr) const noexcept;
+
+    /**
+     * Returns the size in bytes of a block of the given size class.
+     */
+    LIBALEE_SECTION
+    constexpr static Addr blockSize(Cell cls) {
+        return static_cast<Addr>(1u << (cls + 3));
+    }
+
+    /**
+     * Returns the distance from the given entry to the next entry in its
+     * wordlist, or zero if there are none.
+     */
+    Addr next(Addr addr) const noexcept;
+
+    /**
+     * Searches the given wordlist, through its index if it has one.
+     * @param wid The wordlist to search.
+     * @param hash The hash of the searched-for name.
+     * @param match Predicate that is given each entry's name (a Word).
+     * @return The beginning address of the first match or zero if not found.
+     */
+    template<typename Pred>
+    Addr findif(Addr wid, Addr hash, Pred match) noexcept;
+
+    /**
+     * Adds the given entry to a hash index. An entry of the same name is
+     * replaced if `replace` is true, otherwise the index is left as-is.
+     */
+    void insert(Addr table, Addr addr, bool replace) noexcept;
+
+    /**
+     * Case-insensitive hash of a name, for hash indexes.
+     */
+    template<typename Iter>
+    LIBALEE_SECTION
+    constexpr static Addr hash(Iter it, Iter end) {
+        Addr h = 0;
+        for (; it != end; ++it) {
+            auto c = static_cast<uint8_t>(*it);
+            if (isalpha(c))
+                c |= 32;
+            h = static_cast<Addr>(h * 31 + c);
+        }
+        return h;
+    }
+
+    /**
+     * Walks the current definition's local names.
+     * @param match Predicate that is given each local's name (a Word).
+     * @return The index of the first match or -1 if not found.
+     */
+    template<typename Pred>
+    Cell findlocalif(Pred match) noexcept;
+
     /**
      * Case-insensitive character comparison used for dictionary lookup.
      * @return True if the characters are equivalent.
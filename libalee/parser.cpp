@@ -18,28 +18,222 @@
 
 #include "alee.hpp"
 
+#include <algorithm>
+#include <limits>
+
+#ifdef ALEE_FLOAT
+#include <array>
+#include <bit>
+#include <charconv>
+#endif // ALEE_FLOAT
+
 Error (*Parser::customParse)(State&, Word) = nullptr;
 
+/**
+ * Returns true if the given fundamental word may be copied into another
+ * definition: it does not branch, touch the return stack or rely on the
+ * code around it.
+ */
+LIBALEE_SECTION
+static bool inlinable(Cell ins)
+{
+    switch (ins) {
+    case CoreWords::token("_jmp0"):
+    case CoreWords::token("_jmp"):
+    case CoreWords::token(">r"):
+    case CoreWords::token("r>"):
+    case CoreWords::token("_rdepth"):
+    case CoreWords::token("_do"):
+    case CoreWords::token("_loop"):
+    case CoreWords::token("_+loop"):
+    case CoreWords::token("i"):
+    case CoreWords::token("j"):
+    case CoreWords::token("unloop"):
+    case CoreWords::token("_locals"):
+    case CoreWords::token("_local@"):
+    case CoreWords::token("_local!"):
+    case CoreWords::token("_unlocals"):
+    case CoreWords::token("_dovar"):
+    case CoreWords::token("_doconst"):
+    case CoreWords::token("_dovalue"):
+    case CoreWords::token("_dodefer"):
+    case CoreWords::token("_dodoes"):
+    case CoreWords::token("_jmptab"):
+        return false;
+    default:
+        return true;
+    }
+}
+
+/**
+ * Returns true if the given fundamental word may read from the input source
+ * (or run code that does) when executed.
+ */
+LIBALEE_SECTION
+static bool readsInput(Cell ins)
+{
+    return ins == CoreWords::token(":") || ins == CoreWords::token("?:") ||
+           ins == CoreWords::token("_'") || ins == CoreWords::token("_in") ||
+           ins == CoreWords::token("_ev") || ins == CoreWords::token("execute") ||
+           ins == CoreWords::token("sys") || ins == CoreWords::token("key") ||
+           ins == CoreWords::token("word") || ins == CoreWords::token("parse") ||
+           ins == CoreWords::token("parse-name") || ins == CoreWords::token("accept");
+}
+
 LIBALEE_SECTION
 Error Parser::parse(State& state, const char *str)
 {
-    auto addr = Dictionary::Input;
+    return parse(state, std::string_view(str, strlen(str)));
+}
 
-    // Set source and input length
-    const auto len = static_cast<Cell>(strlen(str));
-    state.dict.write(addr, 0);
-    state.dict.write(Dictionary::SourceLen, len);
+LIBALEE_SECTION
+Error Parser::parse(State& state, std::string_view str)
+{
+    constexpr auto space = [](char c) { return isspace(static_cast<uint8_t>(c)); };
+
+    auto it = str.begin();
+    const auto end = str.end();
+
+    while ((it = std::find_if_not(it, end, space)) != end) {
+        const auto wend = std::find_if(it, end, space);
+        const std::string_view word (it, wend);
+        bool imm;
+
+        // A `\` comment ends the line; skipping it here saves copying the
+        // rest of the line into the input buffer.
+        if (word == "\\")
+            break;
+
+        // Same search order as parseWord(), but without touching the
+        // dictionary's input buffer.
+        if (state.compiling()) {
+            const auto local = state.dict.findLocal(word.data(),
+                static_cast<unsigned>(word.size()));
+
+            if (local >= 0) {
+                compileLocal(state, local);
+                it = wend;
+                continue;
+            }
+        }
+
+        Addr ins = state.dict.find(word.data(), static_cast<unsigned>(word.size()));
+        if (ins == 0) {
+            auto cw = CoreWords::findi(word);
+
+            if (cw < 0) {
+                if (parseNumber(state, word.begin(), word.end()) == Error::none) {
+                    it = wend;
+                    continue;
+                } else if (!customParse) {
+                    return Error::noword;
+                }
+
+                // customParse() expects a dictionary-stored word.
+                if (auto r = setSource(state, {it, end}); r != Error::none)
+                    return r;
+                return parseSource(state);
+            } else {
+                ins = cw;
+                imm = ins == CoreWords::token(";");
+            }
+        } else {
+            imm = state.dict.read(ins) & Dictionary::Immediate;
+            ins = state.dict.getexec(ins);
+        }
+
+        if (state.compiling() && !imm) {
+            compileWord(state, ins);
+        } else if (ins >= Dictionary::Begin || readsInput(ins)) {
+            // The word may read from the input source, so that source must now
+            // be made available through the dictionary.
+            if (auto r = setSource(state, {it, end}); r != Error::none)
+                return r;
+            return parseSource(state);
+        } else if (auto stat = execute(state, ins); stat != Error::none) {
+            return stat;
+        }
+
+        it = wend;
+    }
+
+    return Error::none;
+}
+
+LIBALEE_SECTION
+std::size_t Parser::parseBatch(State& state, std::string_view cmds,
+    char delim, BatchResult *results, std::size_t count,
+    char *out, std::size_t outsize)
+{
+    std::size_t n = 0;
+
+    while (n < count && !cmds.empty()) {
+        const auto len = std::min(cmds.find(delim), cmds.size());
+
+        results[n++] = parseCommand(state, cmds.substr(0, len), out, outsize);
+        cmds.remove_prefix(std::min(len + 1, cmds.size()));
+    }
+
+    return n;
+}
+
+LIBALEE_SECTION
+Parser::BatchResult Parser::parseCommand(State& state, std::string_view cmd,
+    char *& out, std::size_t& outsize)
+{
+    state.capture(out, outsize);
+
+    const auto r = parse(state, cmd);
+
+    if (r != Error::none)
+        state.reset();
+
+    state.flush();
+    const auto len = state.captured();
+    state.capture(nullptr, 0);
+
+    const BatchResult result = {r, {out, len}};
+    if (out) {
+        out += len;
+        outsize -= len;
+    }
+
+    return result;
+}
+
+LIBALEE_SECTION
+Error Parser::setSource(State& state, std::string_view str)
+{
+    // Leave room for the null terminator that marks the end of input.
+    constexpr Addr maxlen = Dictionary::InputCells - sizeof(Cell) - 1;
+    constexpr auto space = [](char c) { return isspace(static_cast<uint8_t>(c)); };
+
+    if (str.size() > maxlen) {
+        // A line too long to copy may still fit without its `\` comment.
+        std::size_t i = 0;
+        while (i < str.size() && (str[i] != '\\' || (i > 0 && !space(str[i - 1])) ||
+               (i + 1 < str.size() && !space(str[i + 1]))))
+        {
+            ++i;
+        }
+
+        if (i > maxlen)
+            return Error::input;
+        str = str.substr(0, i);
+    }
+
+    const auto len = static_cast<Addr>(str.size());
+    auto addr = static_cast<Addr>(Dictionary::Input + sizeof(Cell));
 
-    // Fill input buffer with string contents
-    addr += sizeof(Cell);
-    while (*str)
-        state.dict.writebyte(addr++, *str++);
+    state.dict.write(Dictionary::Source, addr);
+    state.dict.write(Dictionary::SourceLen, len);
+    state.dict.write(Dictionary::Input, 0);
 
-    // Zero the remaining input buffer
-    while (addr < Dictionary::Input + Dictionary::InputCells)
-        state.dict.writebyte(addr++, '\0');
+    for (auto it = str.begin(); it != str.begin() + len; ++it)
+        state.dict.writebyte(addr++, static_cast<uint8_t>(*it));
 
-    return parseSource(state);
+    state.dict.writebyte(addr, '\0');
+    return Error::none;
 }
 
 LIBALEE_SECTION
@@ -59,7 +253,14 @@ Error Parser::parseWord(State& state, Word word)
     bool imm;
     Addr ins;
 
-    // Search order: dictionary, core word-set, number, custom parse.
+    // Search order: locals, dictionary, core word-set, number, custom parse.
+    if (state.compiling()) {
+        if (const auto local = state.dict.findLocal(word); local >= 0) {
+            compileLocal(state, local);
+            return Error::none;
+        }
+    }
+
     ins = state.dict.find(word);
     if (ins == 0) {
         auto cw = CoreWords::findi(state, word);
@@ -80,43 +281,471 @@ Error Parser::parseWord(State& state, Word word)
     }
 
     if (state.compiling() && !imm)
-        state.dict.add(ins);
-    else if (auto stat = state.execute(ins); stat != Error::none)
+        compileWord(state, ins);
+    else if (auto stat = execute(state, ins); stat != Error::none)
         return stat;
 
     return Error::none;
 }
 
+LIBALEE_SECTION
+Error Parser::execute(State& state, Addr ins)
+{
+    const auto stat = state.execute(ins);
+
+    state.dict.write(Dictionary::Fold, state.dict.here());
+    return stat;
+}
+
+LIBALEE_SECTION
+void Parser::compileWord(State& state, Addr ins)
+{
+    // Leaving a word early must also leave its frame of locals.
+    if (ins == CoreWords::token("exit") && state.dict.read(Dictionary::Locals) != 0)
+        state.dict.add(CoreWords::token("_unlocals"));
+
+    if (ins >= Dictionary::Begin) {
+        // The address of a variable and the value of a constant are fixed,
+        // so they are compiled as literals.
+        const auto data = static_cast<Addr>(ins + sizeof(Cell) * 2);
+
+        switch (state.dict.read(ins)) {
+        case CoreWords::token("_dovar"):
+            processLiteral(state, static_cast<Cell>(data));
+            return;
+        case CoreWords::token("_doconst"):
+            processLiteral(state, state.dict.read(data));
+            return;
+        default:
+            if (compileInline(state, ins))
+                return;
+            break;
+        }
+    }
+
+    append(state, static_cast<Cell>(ins));
+}
+
+LIBALEE_SECTION
+void Parser::append(State& state, Cell ins)
+{
+    if (!fold(state, ins)) {
+        state.dict.add(ins);
+#ifdef ALEE_PACKED
+        pack(state);
+#endif // ALEE_PACKED
+    }
+}
+
+LIBALEE_SECTION
+bool Parser::compileInline(State& state, Addr xt)
+{
+    auto& dict = state.dict;
+    auto end = xt;
+
+    for (;;) {
+        const auto ins = dict.read(end);
+
+        if (ins == CoreWords::token("exit"))
+            break;
+#ifdef ALEE_PACKED
+        if (CoreWords::packed(ins) ? !inlinable(CoreWords::first(ins)) ||
+                                     !inlinable(CoreWords::second(ins))
+                                   : !inlinable(ins))
+#else
+        if (!inlinable(ins))
+#endif // ALEE_PACKED
+            return false;
+
+        end = static_cast<Addr>(end + (1 + CoreWords::operands(ins)) * sizeof(Cell));
+        if (static_cast<Addr>(end - xt) > InlineLimit * sizeof(Cell))
+            return false;
+    }
+
+    // Literals and words are compiled one by one so that they fold with the
+    // code around them.
+    for (auto addr = xt; addr != end;) {
+        const auto ins = dict.read(addr);
+        const auto next = static_cast<Addr>(addr + (1 + CoreWords::operands(ins)) * sizeof(Cell));
+
+        if (ins == CoreWords::token("_lit")) {
+            processLiteral(state, dict.read(static_cast<Addr>(addr + sizeof(Cell))));
+        } else if (next != addr + sizeof(Cell)) {
+            for (; addr != next; addr = static_cast<Addr>(addr + sizeof(Cell)))
+                dict.add(dict.read(addr));
+#ifdef ALEE_PACKED
+        } else if (CoreWords::packed(ins)) {
+            compileShort(state, CoreWords::first(ins));
+            compileShort(state, CoreWords::second(ins));
+#endif // ALEE_PACKED
+        } else {
+            compileShort(state, ins);
+        }
+
+        addr = next;
+    }
+
+    return true;
+}
+
+LIBALEE_SECTION
+void Parser::compileShort(State& state, Cell ins)
+{
+    if (ins >= CoreWords::WordCount && static_cast<Addr>(ins) < Dictionary::Begin)
+        processLiteral(state, static_cast<Cell>(ins - CoreWords::WordCount));
+    else
+        append(state, ins);
+}
+
+LIBALEE_SECTION
+bool Parser::fold(State& state, Cell ins)
+{
+    constexpr unsigned bits = sizeof(Cell) * 8;
+    unsigned in = 2;
+    unsigned out = 1;
+
+    switch (ins) {
+    case CoreWords::token("drop"):
+        in = 1;
+        out = 0;
+        break;
+    case CoreWords::token("dup"):
+        in = 1;
+        out = 2;
+        break;
+    case CoreWords::token("swap"):
+    case CoreWords::token("m*"):
+        out = 2;
+        break;
+    case CoreWords::token("_/"):
+    case CoreWords::token("_%"):
+        in = 3;
+        break;
+    case CoreWords::token("+"):
+    case CoreWords::token("-"):
+    case CoreWords::token("="):
+    case CoreWords::token("<"):
+    case CoreWords::token("u<"):
+    case CoreWords::token("&"):
+    case CoreWords::token("|"):
+    case CoreWords::token("^"):
+    case CoreWords::token("<<"):
+    case CoreWords::token(">>"):
+        break;
+#ifdef ALEE_STACK_WORDS
+    case CoreWords::token("nip"):
+        break;
+#endif // ALEE_STACK_WORDS
+#ifdef ALEE_MATH_WORDS
+    case CoreWords::token("0="):
+    case CoreWords::token("0<"):
+    case CoreWords::token("1+"):
+    case CoreWords::token("negate"):
+    case CoreWords::token("invert"):
+    case CoreWords::token("cells"):
+    case CoreWords::token("abs"):
+        in = 1;
+        break;
+    case CoreWords::token("min"):
+    case CoreWords::token("max"):
+        break;
+#endif // ALEE_MATH_WORDS
+    default:
+        return false;
+    }
+
+    Addr pos[3];
+    Cell values[3];
+    const auto n = literals(state, pos, values);
+    if (n < in)
+        return false;
+
+    // Operands in stack order, deepest first.
+    const auto a = values[n - in];
+    const auto b = in > 1 ? values[n - in + 1] : a;
+    Cell results[2] = {a, b};
+    DoubleCell dcell;
+
+    switch (ins) {
+    case CoreWords::token("swap"):
+        results[0] = b;
+        results[1] = a;
+        break;
+    case CoreWords::token("+"):
+        results[0] = static_cast<Cell>(a + b);
+        break;
+    case CoreWords::token("-"):
+        results[0] = static_cast<Cell>(a - b);
+        break;
+    case CoreWords::token("m*"):
+        dcell = a * b;
+        results[0] = static_cast<Cell>(dcell);
+        results[1] = static_cast<Cell>(dcell >> bits);
+        break;
+    case CoreWords::token("_/"):
+    case CoreWords::token("_%"):
+        // ( d n -- n ), left for run time if it would fault.
+        dcell = static_cast<DoubleCell>(b) << bits | static_cast<Addr>(a);
+        if (values[n - 1] == 0 || (values[n - 1] == -1 && dcell == std::numeric_limits<DoubleCell>::min()))
+            return false;
+        results[0] = static_cast<Cell>(ins == CoreWords::token("_/") ?
+            dcell / values[n - 1] : dcell % values[n - 1]);
+        break;
+    case CoreWords::token("="):
+        results[0] = a == b ? -1 : 0;
+        break;
+    case CoreWords::token("<"):
+        results[0] = a < b ? -1 : 0;
+        break;
+    case CoreWords::token("u<"):
+        results[0] = static_cast<Addr>(a) < static_cast<Addr>(b) ? -1 : 0;
+        break;
+    case CoreWords::token("&"):
+        results[0] = static_cast<Cell>(a & b);
+        break;
+    case CoreWords::token("|"):
+        results[0] = static_cast<Cell>(a | b);
+        break;
+    case CoreWords::token("^"):
+        results[0] = static_cast<Cell>(a ^ b);
+        break;
+    case CoreWords::token("<<"):
+    case CoreWords::token(">>"):
+        if (static_cast<Addr>(b) >= bits)
+            return false;
+        results[0] = static_cast<Cell>(ins == CoreWords::token("<<") ?
+            static_cast<Addr>(a) << b : static_cast<Addr>(a) >> b);
+        break;
+#ifdef ALEE_STACK_WORDS
+    case CoreWords::token("nip"):
+        results[0] = b;
+        break;
+#endif // ALEE_STACK_WORDS
+#ifdef ALEE_MATH_WORDS
+    case CoreWords::token("0="):
+        results[0] = a == 0 ? -1 : 0;
+        break;
+    case CoreWords::token("0<"):
+        results[0] = a < 0 ? -1 : 0;
+        break;
+    case CoreWords::token("1+"):
+        results[0] = static_cast<Cell>(a + 1);
+        break;
+    case CoreWords::token("negate"):
+        results[0] = static_cast<Cell>(-a);
+        break;
+    case CoreWords::token("invert"):
+        results[0] = static_cast<Cell>(~a);
+        break;
+    case CoreWords::token("cells"):
+        results[0] = static_cast<Cell>(a * static_cast<Cell>(sizeof(Cell)));
+        break;
+    case CoreWords::token("abs"):
+        results[0] = static_cast<Cell>(a < 0 ? -a : a);
+        break;
+    case CoreWords::token("min"):
+        results[0] = std::min(a, b);
+        break;
+    case CoreWords::token("max"):
+        results[0] = std::max(a, b);
+        break;
+#endif // ALEE_MATH_WORDS
+    default: // drop, dup
+        break;
+    }
+
+    state.dict.here(pos[n - in]);
+    for (unsigned i = 0; i < out; ++i)
+        processLiteral(state, results[i]);
+
+    return true;
+}
+
+LIBALEE_SECTION
+unsigned Parser::literals(State& state, Addr *pos, Cell *values)
+{
+    const auto& dict = state.dict;
+    const auto here = dict.here();
+    auto addr = static_cast<Addr>(dict.read(Dictionary::Fold));
+    unsigned n = 0;
+
+    if (addr < Dictionary::Begin || addr > here)
+        return 0;
+
+    // Only the parser compiled this code, so it can be decoded from the start.
+    while (addr < here) {
+        const auto ins = dict.read(addr);
+        const auto next = static_cast<Addr>(addr + length(ins));
+        Cell value;
+
+        if (ins == CoreWords::token("_lit")) {
+            value = dict.read(static_cast<Addr>(addr + sizeof(Cell)));
+        } else if (ins >= CoreWords::WordCount && static_cast<Addr>(ins) < Dictionary::Begin) {
+            value = static_cast<Cell>(ins - CoreWords::WordCount);
+        } else {
+            n = 0;
+            addr = next;
+            continue;
+        }
+
+        if (n == 3) {
+            std::copy(pos + 1, pos + 3, pos);
+            std::copy(values + 1, values + 3, values);
+            --n;
+        }
+
+        pos[n] = addr;
+        values[n++] = value;
+        addr = next;
+    }
+
+    return n;
+}
+
+LIBALEE_SECTION
+Addr Parser::length(Cell ins)
+{
+    const bool op = ins >= 0 && ins < CoreWords::WordCount;
+    return static_cast<Addr>((1 + (op ? CoreWords::operands(ins) : 0)) * sizeof(Cell));
+}
+
+#ifdef ALEE_PACKED
+LIBALEE_SECTION
+void Parser::pack(State& state)
+{
+    auto& dict = state.dict;
+    const auto here = dict.here();
+    auto addr = static_cast<Addr>(dict.read(Dictionary::Fold));
+    auto out = addr;
+    Cell waiting = 0;
+
+    if (addr < Dictionary::Begin || addr > here)
+        return;
+
+    // Rewrites the code in place, pairing up neighbouring short tokens. The
+    // output never overtakes the input.
+    const auto put = [&](Cell token) {
+        if (waiting == 0) {
+            waiting = token;
+        } else {
+            dict.write(out, CoreWords::pack(waiting, token));
+            out = static_cast<Addr>(out + sizeof(Cell));
+            waiting = 0;
+        }
+    };
+    const auto flush = [&] {
+        if (waiting != 0) {
+            dict.write(out, waiting);
+            out = static_cast<Addr>(out + sizeof(Cell));
+            waiting = 0;
+        }
+    };
+
+    while (addr < here) {
+        const auto ins = dict.read(addr);
+        const auto next = static_cast<Addr>(addr + length(ins));
+
+        if (CoreWords::packed(ins)) {
+            put(CoreWords::first(ins));
+            put(CoreWords::second(ins));
+        } else if (CoreWords::packable(ins)) {
+            put(ins);
+        } else {
+            flush();
+            for (; addr != next; addr = static_cast<Addr>(addr + sizeof(Cell))) {
+                dict.write(out, dict.read(addr));
+                out = static_cast<Addr>(out + sizeof(Cell));
+            }
+        }
+
+        addr = next;
+    }
+
+    flush();
+    dict.here(out);
+}
+#endif // ALEE_PACKED
+
+LIBALEE_SECTION
+Addr Parser::compileBranch(State& state)
+{
+    auto& dict = state.dict;
+    Addr pos[3];
+    Cell values[3];
+
+    if (const auto n = literals(state, pos, values); n > 0) {
+        dict.here(pos[n - 1]);
+        if (values[n - 1] != 0)
+            return Dictionary::Fold;
+
+        dict.add(CoreWords::token("_jmp"));
+    } else {
+        dict.add(CoreWords::token("_jmp0"));
+    }
+
+    const auto addr = dict.here();
+    dict.add(0);
+    return addr;
+}
+
+LIBALEE_SECTION
+void Parser::compileLocal(State& state, Cell index)
+{
+    state.dict.add(CoreWords::token("_local@"));
+    state.dict.add(index);
+#ifdef ALEE_PACKED
+    pack(state);
+#endif // ALEE_PACKED
+}
+
 LIBALEE_SECTION
 Error Parser::parseNumber(State& state, Word word)
+{
+    return parseNumber(state, word.begin(&state.dict), word.end(&state.dict));
+}
+
+template<typename Iter>
+LIBALEE_SECTION
+Error Parser::parseNumber(State& state, Iter it, Iter end)
 {
     const auto base = state.dict.read(Dictionary::Base);
-    DoubleCell result = 0;
-    auto it = word.begin(&state.dict);
+    [[maybe_unused]] const auto begin = it;
+    DoubleAddr result = 0;
+    bool dbl = false;
 
     bool inv = *it == '-';
     if (inv)
         ++it;
 
-    const auto end = word.end(&state.dict);
+    const auto digits = it;
     for (uint8_t c; it != end; ++it) {
-        c = *it;
+        c = static_cast<uint8_t>(*it);
 
-        if (isdigit(c)) {
+        if (isdigit(c) && !dbl) {
             result *= base;
             result += c - '0';
-        } else if (isalpha(c) && base > 10) {
+        } else if (isalpha(c) && base > 10 && !dbl) {
             result *= base;
             result += 10 + c - (isupper(c) ? 'A' : 'a');
+        } else if (c == '.' && !dbl && it != digits) {
+            // A trailing point makes a double-cell number.
+            dbl = true;
         } else {
+#ifdef ALEE_FLOAT
+            return parseFloat(state, begin, end);
+#else
             return Error::noword;
+#endif // ALEE_FLOAT
         }
     }
 
     if (inv)
-        result *= -1;
+        result = 0 - result;
 
     processLiteral(state, static_cast<Cell>(result));
+    if (dbl)
+        processLiteral(state, static_cast<Cell>(result >> (sizeof(Cell) * 8)));
+
     return Error::none;
 }
 
@@ -141,3 +770,187 @@ void Parser::processLiteral(State& state, Cell value)
     }
 }
 
+LIBALEE_SECTION
+void Parser::compileJumpTable(State& state, Addr operand)
+{
+    constexpr Addr cell = sizeof(Cell);
+    auto& dict = state.dict;
+#ifdef ALEE_STACK_WORDS
+    constexpr Cell over = CoreWords::token("over");
+#else
+    const auto overdef = dict.find("over", 4);
+    const auto over = overdef != 0 ? static_cast<Cell>(dict.getexec(overdef)) : Cell(0);
+#endif // ALEE_STACK_WORDS
+
+    dict.add(CoreWords::token("drop"));
+    dict.add(CoreWords::token("_jmp"));
+    const auto skip = dict.here();
+    dict.add(0);
+
+    // Table: entry count, the address reached when no key matches, then
+    // pairs of key and branch address sorted by key.
+    const auto table = dict.here();
+    Cell count = 0;
+    dict.add(0);
+    dict.add(0);
+
+    // Each `of` compiles `key over = _jmp0 next drop`; follow the chain of
+    // those with a literal key.
+    auto test = static_cast<Addr>(operand + cell);
+    for (;;) {
+        auto addr = test;
+        Cell key;
+
+        if (const auto ins = dict.read(addr); ins == CoreWords::token("_lit")) {
+            key = dict.read(static_cast<Addr>(addr + cell));
+            addr = static_cast<Addr>(addr + cell * 2);
+        } else if (ins >= CoreWords::WordCount && static_cast<Addr>(ins) < Dictionary::Begin) {
+            key = static_cast<Cell>(ins - CoreWords::WordCount);
+            addr = static_cast<Addr>(addr + cell);
+        } else {
+            break;
+        }
+
+        const auto next = static_cast<Addr>(dict.read(static_cast<Addr>(addr + cell * 3)));
+        if (over == 0 || dict.read(addr) != over ||
+            dict.read(static_cast<Addr>(addr + cell)) != CoreWords::token("=") ||
+            dict.read(static_cast<Addr>(addr + cell * 2)) != CoreWords::token("_jmp0") ||
+            next <= test)
+        {
+            break;
+        }
+
+        // Insert the key in order unless an earlier test already has it.
+        Cell i = 0;
+        while (i < count && dict.read(static_cast<Addr>(table + cell * (2 + 2 * i))) < key)
+            ++i;
+
+        if (i == count || dict.read(static_cast<Addr>(table + cell * (2 + 2 * i))) != key) {
+            dict.add(0);
+            dict.add(0);
+
+            for (auto j = count; j > i; --j) {
+                const auto dst = static_cast<Addr>(table + cell * (2 + 2 * j));
+                dict.write(dst, dict.read(static_cast<Addr>(dst - cell * 2)));
+                dict.write(static_cast<Addr>(dst + cell), dict.read(static_cast<Addr>(dst - cell)));
+            }
+
+            const auto entry = static_cast<Addr>(table + cell * (2 + 2 * i));
+            dict.write(entry, key);
+            dict.write(static_cast<Addr>(entry + cell), static_cast<Cell>(addr + cell * 4));
+            ++count;
+        }
+
+        test = next;
+    }
+
+    if (count > 0) {
+        dict.write(table, count);
+        dict.write(static_cast<Addr>(table + cell), static_cast<Cell>(test));
+        dict.write(skip, static_cast<Cell>(dict.here()));
+        dict.write(operand, static_cast<Cell>(table));
+    } else {
+        // No table: the `_jmptab` becomes a jump to what follows it.
+        dict.here(static_cast<Addr>(skip - cell));
+        dict.write(static_cast<Addr>(operand - cell), CoreWords::token("_jmp"));
+        dict.write(operand, static_cast<Cell>(operand + cell));
+    }
+}
+
+#ifdef ALEE_FLOAT
+template<typename Iter>
+LIBALEE_SECTION
+Error Parser::parseFloat(State& state, Iter it, Iter end)
+{
+    char buf[32];
+    std::size_t len = 0;
+    bool exp = false;
+
+    if (state.dict.read(Dictionary::Base) != 10)
+        return Error::noword;
+
+    for (; it != end; ++it) {
+        if (len == sizeof(buf))
+            return Error::noword;
+
+        buf[len] = static_cast<char>(*it);
+        exp |= buf[len] == 'e' || buf[len] == 'E';
+        ++len;
+    }
+
+    if (Float f; exp && toFloat(buf, len, f)) {
+        processLiteral(state, f);
+        return Error::none;
+    }
+
+    return Error::noword;
+}
+
+LIBALEE_SECTION
+void Parser::processLiteral(State& state, Float value)
+{
+    if (state.compiling()) {
+        const auto bits = std::bit_cast<std::array<Cell, sizeof(Float) / sizeof(Cell)>>(value);
+
+        state.dict.add(CoreWords::token("_flit"));
+        for (auto c : bits)
+            state.dict.add(c);
+    } else {
+        state.fpush(value);
+    }
+}
+
+LIBALEE_SECTION
+bool Parser::toFloat(const char *str, std::size_t len, Float& result)
+{
+    // Rewritten into the form accepted by from_chars: [-]digits[.digits]e[-]digits
+    char buf[40];
+    std::size_t n = 0;
+    std::size_t i = 0;
+    unsigned digits = 0;
+
+    const auto copydigits = [&] {
+        unsigned count = 0;
+        while (i < len && isdigit(static_cast<uint8_t>(str[i])) && n < sizeof(buf) - 4) {
+            buf[n++] = str[i++];
+            ++count;
+        }
+        return count;
+    };
+
+    if (i < len && (str[i] == '-' || str[i] == '+')) {
+        if (str[i] == '-')
+            buf[n++] = '-';
+        ++i;
+    }
+
+    digits = copydigits();
+    if (i < len && str[i] == '.') {
+        buf[n++] = str[i++];
+        digits += copydigits();
+    }
+
+    if (digits == 0)
+        return false;
+
+    buf[n++] = 'e';
+    if (i < len) {
+        const auto c = static_cast<uint8_t>(str[i]);
+        if (c == 'e' || c == 'E' || c == 'd' || c == 'D')
+            ++i;
+        else if (c != '+' && c != '-')
+            return false;
+
+        if (i < len && (str[i] == '-' || str[i] == '+')) {
+            if (str[i] == '-')
+                buf[n++] = '-';
+            ++i;
+        }
+    }
+
+    if (copydigits() == 0)
+        buf[n++] = '0';
+
+    return i == len && std::from_chars(buf, buf + n, result).ec == std::errc();
+}
+#endif // ALEE_FLOAT
@@ -25,6 +25,7 @@
 #include "types.hpp"
 #include "state.hpp"
 
+#include <cstddef>
 #include <string_view>
 
 /**
@@ -34,22 +35,94 @@
 class Parser
 {
 public:
+    /**
+     * Largest definition body, in cells, that is copied into definitions
+     * that use it instead of being called.
+     */
+    constexpr static Addr InlineLimit = 4;
+
     /**
      * Pointer to a user-provided function that
      */
     static Error (*customParse)(State&, Word);
 
     /**
-     * Parses and evaluates the given string using the given state.
-     * The string is stored in the state's input buffer before parseSource()
-     * is called.
+     * Parses and evaluates the given null-terminated string using the given
+     * state.
      * @param state The state to parse and evaluate with.
      * @param str The string to parse.
      * @return Error token to indicate if parsing was successful.
-     * @see parseSource(State&)
+     * @see parse(State&, std::string_view)
      */
     static Error parse(State& state, const char *str);
 
+    /**
+     * Parses and evaluates the given string using the given state.
+     * Words are read directly from the caller's string. The remaining string
+     * is only copied into the state's input buffer when a word that may read
+     * from the input source is executed; parseSource() takes over from there.
+     * @param state The state to parse and evaluate with.
+     * @param str The string to parse. Must remain valid until return.
+     * @return Error token to indicate if parsing was successful.
+     * @see parseSource(State&)
+     */
+    static Error parse(State& state, std::string_view str);
+
+    /**
+     * Result of one command of a batch.
+     */
+    struct BatchResult {
+        Error error = Error::none; /** Error token of the command */
+        std::string_view output; /** Output of the command, within the batch's buffer */
+    };
+
+    /**
+     * Parses and evaluates a batch of commands separated by the given
+     * delimiter. A failing command has its error recorded and the state reset,
+     * then evaluation continues with the next command.
+     * Each command's output is captured into the caller's buffer, one command
+     * after another; output that does not fit is dropped. With a null buffer,
+     * output goes to the state's output function instead.
+     * @param state The state to parse and evaluate with.
+     * @param cmds The commands to parse. A trailing delimiter is ignored.
+     * @param delim The character that separates commands.
+     * @param results Caller-provided array that receives each command's result.
+     * @param count Capacity of results; further commands are not evaluated.
+     * @param out Caller-provided buffer that receives the commands' output.
+     * @param outsize Size of the output buffer, number of characters.
+     * @return The number of commands that were evaluated.
+     */
+    static std::size_t parseBatch(State& state, std::string_view cmds,
+        char delim, BatchResult *results, std::size_t count,
+        char *out = nullptr, std::size_t outsize = 0);
+
+    /**
+     * Parses and evaluates a batch of commands given by an iterator range
+     * (e.g. of a vector of strings). Error handling and output capture match
+     * the above.
+     * @param state The state to parse and evaluate with.
+     * @param it Beginning iterator of the commands.
+     * @param end Past-the-end iterator of the commands.
+     * @param results Caller-provided array that receives each command's result.
+     * @param count Capacity of results; further commands are not evaluated.
+     * @param out Caller-provided buffer that receives the commands' output.
+     * @param outsize Size of the output buffer, number of characters.
+     * @return The number of commands that were evaluated.
+     */
+    template<typename Iter>
+    LIBALEE_SECTION
+    static std::size_t parseBatch(State& state, Iter it, Iter end,
+        BatchResult *results, std::size_t count,
+        char *out = nullptr, std::size_t outsize = 0)
+    {
+        std::size_t n = 0;
+
+        for (; n < count && it != end; ++it)
+            results[n++] = parseCommand(state, *it, out, outsize);
+
+        return n;
+    }
+
     /**
      * Parses through and compiles or evaluates the words stored in the state's
      * input source.
@@ -67,13 +140,131 @@ public:
      */
     static void processLiteral(State& state, Cell value);
 
+    /**
+     * Compiles the conditional jump of `if` or `until`. If the condition is
+     * a literal compiled just before, the literal is removed and the jump
+     * becomes unconditional (for zero) or is left out.
+     * @param state The state to compile with.
+     * @return The address to store the jump's target at. A left out jump
+     *         gives the Fold cell, which is reset after the compiling word.
+     */
+    static Addr compileBranch(State& state);
+
+    /**
+     * Concludes a `case`: compiles the default's `drop`, then a table for
+     * the `_jmptab` that begins the case. The table maps each literal `of`
+     * key to its branch, sorted for a binary search. Keys from the first
+     * computed one on are still tested in order.
+     * @param state The state to compile with.
+     * @param operand The address of the `_jmptab`'s operand.
+     */
+    static void compileJumpTable(State& state, Addr operand);
+
+#ifdef ALEE_FLOAT
+    /**
+     * Pushes the given float to the float stack or compiles it.
+     * @param state The state to give the value to.
+     * @param value The value to process.
+     */
+    static void processLiteral(State& state, Float value);
+
+    /**
+     * Converts a string in the syntax accepted by `>float` into a float:
+     * a signed significand with an optional exponent introduced by E or D.
+     * @param str The string to convert.
+     * @param len The length of the string.
+     * @param result Receives the value on success.
+     * @return True if the whole string was converted.
+     */
+    static bool toFloat(const char *str, std::size_t len, Float& result);
+#endif // ALEE_FLOAT
+
 private:
+    /**
+     * Parses a single command of a batch, resetting the state on failure.
+     * The command's output is captured at out, which is then advanced past it.
+     * @return The command's error token and output.
+     */
+    static BatchResult parseCommand(State& state, std::string_view cmd,
+        char *& out, std::size_t& outsize);
+
     /**
      * Parses the given word using the given state.
      * @return Error token to indicate if parsing was successful.
      */
     static Error parseWord(State&, Word);
 
+    /**
+     * Executes the given word. Code compiled before it is no longer folded
+     * or packed, since the word may have taken an address within it (e.g.
+     * as a jump target).
+     * @return Error token to indicate if execution was successful.
+     */
+    static Error execute(State& state, Addr ins);
+
+    /**
+     * Compiles the given execution token into the current definition.
+     * Short definitions are inlined, see compileInline().
+     * An `exit` also leaves the definition's frame of locals, if it has one.
+     */
+    static void compileWord(State& state, Addr ins);
+
+    /**
+     * Copies the body of the given definition into the current one if it is
+     * no longer than InlineLimit and does not depend on where it executes:
+     * no jumps, return stack access, loops or locals.
+     * @return True if the body was copied.
+     */
+    static bool compileInline(State& state, Addr xt);
+
+    /**
+     * Compiles a single-cell instruction after the current definition's
+     * code, folding it with the literals before it where possible.
+     */
+    static void append(State& state, Cell ins);
+
+    /**
+     * Compiles a token that fits in a cell: a compacted literal, a
+     * fundamental word or a call.
+     */
+    static void compileShort(State& state, Cell ins);
+
+    /**
+     * Evaluates the given pure fundamental word at compile time if enough of
+     * its operands are literals compiled just before, replacing those
+     * literals with the word's results.
+     * @return True if the word was folded.
+     */
+    static bool fold(State& state, Cell ins);
+
+    /**
+     * Decodes the literals at the end of the code compiled since the last
+     * word was executed, keeping the last three.
+     * @param pos Receives the address of each kept literal.
+     * @param values Receives the value of each kept literal.
+     * @return The number of literals kept.
+     */
+    static unsigned literals(State& state, Addr *pos, Cell *values);
+
+    /**
+     * Returns the size in bytes of the compiled instruction ins begins,
+     * including its operands.
+     */
+    static Addr length(Cell ins);
+
+#ifdef ALEE_PACKED
+    /**
+     * Packs pairs of neighbouring short tokens in the code compiled since
+     * the last word was executed into single cells.
+     */
+    static void pack(State& state);
+#endif // ALEE_PACKED
+
+    /**
+     * Compiles a fetch of the current definition's local of the given index.
+     */
+    static void compileLocal(State& state, Cell index);
+
     /**
      * Attempts to parse the given word into a number.
      * @param state The state object with the dictionary containing the word.
@@ -81,6 +272,35 @@ private:
      * @return Error token to indicate if parsing was successful.
      */
     static Error parseNumber(State& state, Word word);
+
+    /**
+     * Attempts to parse the characters in the given range into a number.
+     * A number that ends with a point (e.g. `123.`) is a double-cell number.
+     * @param state The state object to give the number to.
+     * @param it Beginning iterator of the characters to parse.
+     * @param end Past-the-end iterator of the characters to parse.
+     * @return Error token to indicate if parsing was successful.
+     */
+    template<typename Iter>
+    static Error parseNumber(State& state, Iter it, Iter end);
+
+#ifdef ALEE_FLOAT
+    /**
+     * Attempts to parse the characters in the given range into a float
+     * literal, which must contain an exponent marker (e.g. `1e`, `2.5E-3`).
+     * @return Error token to indicate if parsing was successful.
+     */
+    template<typename Iter>
+    static Error parseFloat(State& state, Iter it, Iter end);
+#endif // ALEE_FLOAT
+
+    /**
+     * Copies the given string into the state's input buffer and makes that
+     * buffer the current input source.
+     * @return Error::input if the string does not fit in the buffer, otherwise
+     *         Error::none.
+     */
+    static Error setSource(State& state, std::string_view str);
 };
 
 #endif // ALEEFORTH_PARSER_HPP
@@ -18,6 +18,7 @@
 
 #include "alee.hpp"
 
+#include <algorithm>
 #include <iterator>
 
 LIBALEE_SECTION
@@ -47,15 +48,25 @@ void State::load(const State::Context& ctx)
 LIBALEE_SECTION
 Error State::execute(Addr addr)
 {
+#ifndef ALEE_GUARD_PAGES
     auto stat = static_cast<Error>(setjmp(context.jmpbuf));
+#else
+    auto stat = static_cast<Error>(sigsetjmp(context.jmpbuf, 1));
+#endif // ALEE_GUARD_PAGES
 
     if (stat == Error::none) {
+        if (tracebuf != nullptr)
+            record(static_cast<Cell>(addr));
         CoreWords::run(addr, *this);
 
         if (context.ip >= Dictionary::Begin) {
             // longjmp will exit this loop.
-            for (;;)
-                CoreWords::run(dict.read(context.ip), *this);
+            for (;;) {
+                const auto ins = dict.read(context.ip);
+                if (tracebuf != nullptr) [[unlikely]]
+                    record(ins);
+                CoreWords::run(ins, *this);
+            }
         } else {
             // addr was a CoreWord, all done now.
             context.ip = 0;
@@ -70,15 +81,69 @@ Error State::execute(Addr addr)
 LIBALEE_SECTION
 void State::reset()
 {
-    while (size())
-        pop();
-    while (rsize())
-        popr();
+    dsp = dstack;
+    rsp = rstack;
+    fp = rstack;
+#ifdef ALEE_FLOAT
+    fsp = fstack;
+#endif // ALEE_FLOAT
 
     dict.write(Dictionary::Compiling, 0);
+    dict.clearLocals();
     context.ip = 0;
 }
 
+LIBALEE_SECTION
+void State::trace(TraceEntry *buf, std::size_t n) noexcept
+{
+    tracebuf = n > 0 ? buf : nullptr;
+    tracelen = n;
+    tracepos = 0;
+    tracecount = 0;
+}
+
+LIBALEE_SECTION
+void State::output(std::string_view str) noexcept
+{
+    if (str.size() <= OutputBufferSize - outlen) {
+        std::copy(str.begin(), str.end(), outbuf + outlen);
+        outlen += str.size();
+    } else {
+        flush();
+        write(str.data(), str.size());
+    }
+}
+
+LIBALEE_SECTION
+void State::flush() noexcept
+{
+    if (outlen > 0) {
+        write(outbuf, outlen);
+        outlen = 0;
+    }
+}
+
+LIBALEE_SECTION
+void State::write(const char *str, std::size_t n) noexcept
+{
+    if (capbuf) {
+        n = std::min(n, capsize - caplen);
+        std::copy(str, str + n, capbuf + caplen);
+        caplen += n;
+    } else {
+        outputfunc(*this, str, n);
+    }
+}
+
+LIBALEE_SECTION
+void State::capture(char *buf, std::size_t size) noexcept
+{
+    flush();
+    capbuf = buf;
+    capsize = buf ? size : 0;
+    caplen = 0;
+}
+
 LIBALEE_SECTION
 std::size_t State::size() const noexcept
 {
@@ -26,31 +26,69 @@
 #include "types.hpp"
 
 #include <csetjmp>
+#ifdef ALEE_GUARD_PAGES
+#include <setjmp.h>
+#endif // ALEE_GUARD_PAGES
 #include <cstddef>
+#include <string_view>
 
 /**
- * Size of the primary data stack, number of cells.
+ * Default size of the primary data stack, number of cells.
  */
 constexpr unsigned DataStackSize = 64;
 
 /**
- * Size of the return stack, number of cells.
+ * Default size of the return stack, number of cells.
  */
 constexpr unsigned ReturnStackSize = 64;
 
+#ifdef ALEE_FLOAT
+/**
+ * Default size of the floating-point stack, number of floats.
+ */
+constexpr unsigned FloatStackSize = DataStackSize;
+#endif // ALEE_FLOAT
+
+/**
+ * Size of the output buffer, number of characters.
+ */
+constexpr unsigned OutputBufferSize = 32;
+
+/**
+ * An instruction recorded by the execution tracer.
+ */
+struct TraceEntry {
+    Addr ip; /** Address of the instruction */
+    Cell ins; /** The instruction: an opcode, a compacted literal or a call */
+    Cell top; /** Top of the data stack before execution, or zero if empty */
+    Cell depth; /** Depth of the data stack before execution */
+};
+
 /**
  * @class State
  * Object to track execution state.
  */
 class State
 {
-    /** Input functions should add input to the input buffer when available. */
+    /**
+     * Input functions should add input to the input buffer when available,
+     * keeping the buffer null-terminated.
+     */
     using InputFunc = void (*)(State&);
 
+    /** Output functions should display or store the given characters. */
+    using OutputFunc = void (*)(State&, const char *, std::size_t);
+
     /** Context object that defines a state of execution. */
     struct Context {
         Addr ip = 0; /** Instruction pointer */
+#ifndef ALEE_GUARD_PAGES
         std::jmp_buf jmpbuf = {}; /** setjmp() buffer for exiting execute() */
+#else
+        // Guard page faults leave their signal handler through this buffer,
+        // so the signal mask must be saved and restored along with it.
+        sigjmp_buf jmpbuf = {}; /** sigsetjmp() buffer for exiting execute() */
+#endif // ALEE_GUARD_PAGES
     };
 
 public:
@@ -58,13 +96,65 @@ public:
     Dictionary& dict;
 
     /**
-     * Constructs a state object that uses the given dictionary and input
-     * function.
+     * Constructs a state object that uses the given dictionary, input
+     * function, output function and stack memory.
+     * @param d The dictionary to be used by this state
+     * @param i The input collection function to be used by this state
+     * @param o The output function to be used by this state
+     * @param ds Memory to be used as the data stack
+     * @param dn Size of the data stack, number of cells
+     * @param rs Memory to be used as the return stack
+     * @param rn Size of the return stack, number of cells
+     * @param fs Memory to be used as the float stack, or null for none
+     * @param fn Size of the float stack, number of floats
+     */
+#ifndef ALEE_FLOAT
+    constexpr State(Dictionary& d, InputFunc i, OutputFunc o,
+                    Cell *ds, std::size_t dn, Cell *rs, std::size_t rn):
+        dict(d), inputfunc(i), outputfunc(o), context(),
+        dstack(ds), dsend(ds + dn), rstack(rs), rsend(rs + rn),
+        dsp(ds), rsp(rs), fp(rs) {}
+#else
+    constexpr State(Dictionary& d, InputFunc i, OutputFunc o,
+                    Cell *ds, std::size_t dn, Cell *rs, std::size_t rn,
+                    Float *fs = nullptr, std::size_t fn = 0):
+        dict(d), inputfunc(i), outputfunc(o), context(),
+        dstack(ds), dsend(ds + dn), rstack(rs), rsend(rs + rn),
+        dsp(ds), rsp(rs), fp(rs), fstack(fs), fsend(fs + fn), fsp(fs) {}
+#endif // ALEE_FLOAT
+
+    /**
+     * Constructs a state object with stacks stored in the given arrays.
+     * @param d The dictionary to be used by this state
+     * @param i The input collection function to be used by this state
+     * @param o The output function to be used by this state
+     * @param ds Array to be used as the data stack
+     * @param rs Array to be used as the return stack
+     */
+    template<std::size_t DN, std::size_t RN>
+    constexpr State(Dictionary& d, InputFunc i, OutputFunc o,
+                    Cell (&ds)[DN], Cell (&rs)[RN]):
+        State(d, i, o, ds, DN, rs, RN) {}
+
+#ifdef ALEE_FLOAT
+    /**
+     * Constructs a state object with stacks, including the float stack,
+     * stored in the given arrays.
      * @param d The dictionary to be used by this state
      * @param i The input collection function to be used by this state
+     * @param o The output function to be used by this state
+     * @param ds Array to be used as the data stack
+     * @param rs Array to be used as the return stack
+     * @param fs Array to be used as the float stack
      */
-    constexpr State(Dictionary& d, InputFunc i):
-        dict(d), inputfunc(i), context() {}
+    template<std::size_t DN, std::size_t RN, std::size_t FN>
+    constexpr State(Dictionary& d, InputFunc i, OutputFunc o,
+                    Cell (&ds)[DN], Cell (&rs)[RN], Float (&fs)[FN]):
+        State(d, i, o, ds, DN, rs, RN, fs, FN) {}
+#endif // ALEE_FLOAT
+
+    State(const State&) = delete;
+    State& operator=(const State&) = delete;
 
     /**
      * Begins execution starting from the given execution token.
@@ -78,7 +168,7 @@ public:
 
     /**
      * Clears the data and return stacks, sets ip to zero, and clears the
-     * compiling flag.
+     * compiling flag and any locals being compiled.
      */
     void reset();
 
@@ -88,17 +178,75 @@ public:
         return context.ip;
     }
 
-    /** Calls the user input function with this state as the argument. */
+    /**
+     * Calls the user input function with this state as the argument.
+     * Pending output is flushed first.
+     */
     LIBALEE_SECTION
     void input() noexcept {
+        flush();
         inputfunc(*this);
     }
 
+    /**
+     * Buffers the given character for output, flushing the buffer if full.
+     */
+    LIBALEE_SECTION
+    void output(char c) noexcept {
+        if (outlen == OutputBufferSize)
+            flush();
+        outbuf[outlen++] = c;
+    }
+
+    /**
+     * Buffers the given characters for output. Strings that do not fit in
+     * the buffer are passed on in one piece after pending output is flushed.
+     */
+    void output(std::string_view str) noexcept;
+
+    /**
+     * Passes all buffered output to the user output function, or to the
+     * capture buffer if one is set.
+     */
+    void flush() noexcept;
+
+    /**
+     * Redirects output into the given buffer in place of the user output
+     * function. Output that does not fit is dropped. A null buffer restores
+     * the output function. Pending output is flushed first.
+     * @param buf Buffer to receive output, or null.
+     * @param size Size of the buffer, number of characters.
+     */
+    void capture(char *buf, std::size_t size) noexcept;
+
+    /** Returns the count of characters captured since capture() was called. */
+    LIBALEE_SECTION
+    std::size_t captured() const noexcept {
+        return caplen;
+    }
+
     /** Returns true if currently in a compiling state. */
     bool compiling() const;
     /** Sets the compiling state. True if compiling, false if interpreting. */
     void compiling(bool);
 
+    /**
+     * Starts recording each executed instruction into the given ring
+     * buffer, replacing any previous buffer and count.
+     * @param buf Memory for the ring buffer, or nullptr to stop tracing
+     * @param n Size of the buffer, number of entries
+     */
+    void trace(TraceEntry *buf, std::size_t n) noexcept;
+
+    /**
+     * Returns the number of instructions recorded since tracing began.
+     * The latest is at index (traced() - 1) % n of the buffer.
+     */
+    LIBALEE_SECTION
+    std::size_t traced() const noexcept {
+        return tracecount;
+    }
+
     /** Returns the number of values stored on the data stack. */
     std::size_t size() const noexcept;
     /** Returns the number of values stored on the return stack. */
@@ -119,7 +267,7 @@ public:
      */
     LIBALEE_SECTION
     inline void push(Cell value) {
-        verify(dsp < dstack + DataStackSize, Error::push);
+        checkStack(dsp < dsend, Error::push);
         *dsp++ = value;
     }
 
@@ -128,7 +276,7 @@ public:
      */
     LIBALEE_SECTION
     inline Cell pop() {
-        verify(dsp > dstack, Error::pop);
+        checkStack(dsp > dstack, Error::pop);
         return *--dsp;
     }
 
@@ -137,7 +285,7 @@ public:
      */
     LIBALEE_SECTION
     inline void pushr(Cell value) {
-        verify(rsp < rstack + ReturnStackSize, Error::pushr);
+        checkStack(rsp < rsend, Error::pushr);
         *rsp++ = value;
     }
 
@@ -146,7 +294,7 @@ public:
      */
     LIBALEE_SECTION
     inline Cell popr() {
-        verify(rsp > rstack, Error::popr);
+        checkStack(rsp > rstack, Error::popr);
         return *--rsp;
     }
 
@@ -155,7 +303,7 @@ public:
      */
     LIBALEE_SECTION
     inline Cell& top() {
-        verify(dsp > dstack, Error::top);
+        checkStack(dsp > dstack, Error::top);
         return *(dsp - 1);
     }
 
@@ -170,6 +318,87 @@ public:
         return *(dsp - i - 1);
     }
 
+    /**
+     * Picks a value currently in the return stack.
+     */
+    LIBALEE_SECTION
+    inline Cell& rpick(std::size_t i) {
+        verify(rsp - i > rstack, Error::popr);
+        return *(rsp - i - 1);
+    }
+
+    /**
+     * Begins a frame of locals on the return stack, saving the previous
+     * frame pointer beneath it. The frame's locals are zeroed, then the
+     * first ones are initialized from the data stack.
+     * @param count The number of locals in the frame
+     * @param init The number of locals taken from the data stack
+     */
+    LIBALEE_SECTION
+    inline void enterFrame(unsigned count, unsigned init) {
+        pushr(static_cast<Cell>(fp - rstack));
+        fp = rsp;
+        for (auto i = count; i > 0; --i)
+            pushr(0);
+        while (init > 0)
+            fp[--init] = pop();
+    }
+
+    /**
+     * Ends the current frame of locals, dropping anything above it from the
+     * return stack and restoring the previous frame.
+     */
+    LIBALEE_SECTION
+    inline void leaveFrame() {
+        verify(fp > rstack && fp <= rsp, Error::popr);
+        rsp = fp;
+        fp = rstack + popr();
+    }
+
+    /**
+     * Returns a reference to the given local of the current frame.
+     */
+    LIBALEE_SECTION
+    inline Cell& local(std::size_t i) {
+        verify(fp + i < rsp, Error::popr);
+        return fp[i];
+    }
+
+#ifdef ALEE_FLOAT
+    /** Returns the number of values stored on the float stack. */
+    LIBALEE_SECTION
+    std::size_t fsize() const noexcept {
+        return fsp - fstack;
+    }
+
+    /**
+     * Pushes the given value to the float stack.
+     */
+    LIBALEE_SECTION
+    inline void fpush(Float value) {
+        verify(fsp < fsend, Error::fpush);
+        *fsp++ = value;
+    }
+
+    /**
+     * Pops a value from the float stack and returns that value.
+     */
+    LIBALEE_SECTION
+    inline Float fpop() {
+        verify(fsp > fstack, Error::fpop);
+        return *--fsp;
+    }
+
+    /**
+     * Picks a value currently stored on the float stack.
+     */
+    LIBALEE_SECTION
+    inline Float& fpick(std::size_t i) {
+        verify(fsp - i > fstack, Error::fpop);
+        return *(fsp - i - 1);
+    }
+#endif // ALEE_FLOAT
+
     /**
      * Advances the instruction pointer and returns that cell's contents.
      */
@@ -187,18 +416,89 @@ public:
      */
     LIBALEE_SECTION
     inline void verify(bool condition, Error error) {
+#ifndef ALEE_GUARD_PAGES
         if (!condition)
             std::longjmp(context.jmpbuf, static_cast<int>(error));
+#else
+        if (!condition)
+            siglongjmp(context.jmpbuf, static_cast<int>(error));
+#endif // ALEE_GUARD_PAGES
+    }
+
+#ifdef ALEE_GUARD_PAGES
+    /**
+     * Reports a stack fault caught by a guard page. The faulting access has
+     * already moved a stack pointer out of bounds, so the stacks are cleared
+     * before execution leaves through execute() with the given error.
+     * @param error Error code to report
+     */
+    LIBALEE_SECTION
+    [[noreturn]] void fault(Error error) noexcept {
+        dsp = dstack;
+        rsp = rstack;
+        fp = rstack;
+        siglongjmp(context.jmpbuf, static_cast<int>(error));
+    }
+#endif // ALEE_GUARD_PAGES
+
+    /**
+     * Stack bounds check used by push, pop and their return stack variants.
+     * When ALEE_GUARD_PAGES is defined, the stacks must be bounded by guard
+     * pages (see guardstack.hpp) that catch overflow and underflow instead.
+     */
+    LIBALEE_SECTION
+    inline void checkStack([[maybe_unused]] bool condition,
+                           [[maybe_unused]] Error error) {
+#ifndef ALEE_GUARD_PAGES
+        verify(condition, error);
+#endif
     }
 
 private:
     InputFunc inputfunc; /** User-provided function to collect user input. */
+    OutputFunc outputfunc; /** User-provided function to display output. */
     Context context; /** State's current execution context. */
 
-    Cell dstack[DataStackSize] = {}; /** Data stack */
-    Cell rstack[ReturnStackSize] = {}; /** Return stack */
-    Cell *dsp = dstack; /** Current data stack position */
-    Cell *rsp = rstack; /** Current return stack position */
+    char outbuf[OutputBufferSize] = {}; /** Output buffer */
+    std::size_t outlen = 0; /** Count of characters in the output buffer */
+    char *capbuf = nullptr; /** Buffer capturing output, if any */
+    std::size_t capsize = 0; /** Size of the capture buffer */
+    std::size_t caplen = 0; /** Count of characters captured */
+
+    Cell *dstack; /** Data stack */
+    Cell *dsend; /** End of the data stack */
+    Cell *rstack; /** Return stack */
+    Cell *rsend; /** End of the return stack */
+    Cell *dsp; /** Current data stack position */
+    Cell *rsp; /** Current return stack position */
+    Cell *fp; /** Beginning of the current frame of locals */
+
+    TraceEntry *tracebuf = nullptr; /** Tracer's ring buffer, if tracing */
+    std::size_t tracelen = 0; /** Size of the tracer's ring buffer */
+    std::size_t tracepos = 0; /** Index of the next entry to record */
+    std::size_t tracecount = 0; /** Count of instructions recorded */
+
+    /**
+     * Passes the given characters to the capture buffer if one is set, or
+     * else to the user output function.
+     */
+    void write(const char *str, std::size_t n) noexcept;
+
+    /** Records the given instruction, about to execute, for the tracer. */
+    LIBALEE_SECTION
+    inline void record(Cell ins) noexcept {
+        tracebuf[tracepos] = {context.ip, ins, dsp > dstack ? dsp[-1] : Cell(0),
+                              static_cast<Cell>(dsp - dstack)};
+        if (++tracepos == tracelen)
+            tracepos = 0;
+        ++tracecount;
+    }
+
+#ifdef ALEE_FLOAT
+    Float *fstack; /** Floating-point stack */
+    Float *fsend; /** End of the floating-point stack */
+    Float *fsp; /** Current float stack position */
+#endif // ALEE_FLOAT
 };
 
 #endif // ALEEFORTH_STATE_HPP
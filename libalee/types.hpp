@@ -21,6 +21,8 @@
 #ifndef ALEEFORTH_TYPES_HPP
 #define ALEEFORTH_TYPES_HPP
 
+#include "config.hpp"
+
 #include <cstdint>
 #include <iterator>
 
@@ -33,6 +35,11 @@ using DoubleCell = int32_t;
 /** Double-width addr type. Must be twice the size of Addr. Used by um/mod. */
 using DoubleAddr = uint32_t;
 
+#ifdef ALEE_FLOAT
+/** Floating-point type. Stored in the dictionary as a whole number of cells. */
+using Float = double;
+#endif // ALEE_FLOAT
+
 struct Dictionary;
 struct State;
 
@@ -48,7 +55,12 @@ enum class Error : int {
     top,   /** Could not fetch data stack top (data stack underflow) */
     pick,  /** Could not pick data stack value (data stack underflow) */
     exit,  /** No error, exited from State::execute() */
-    noword /** Parsing failed because the word was not found */
+    noword, /** Parsing failed because the word was not found */
+    fpush, /** Could not push (float stack overflow) */
+    fpop,  /** Could not pop (float stack underflow) */
+    input, /** Input line does not fit in the input buffer */
+    block, /** A block could not be read or written */
+    file   /** A file could not be opened */
 };
 
 /**
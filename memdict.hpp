@@ -65,6 +65,12 @@ public:
     virtual unsigned long int capacity() const noexcept final {
         return sizeof(dict);
     }
+
+    /** Returns a pointer to the given range, which must fit in the block. */
+    virtual uint8_t *contiguous(Addr addr, Addr size) noexcept final {
+        return addr + static_cast<unsigned long int>(size) <= sizeof(dict)
+            ? dict + addr : nullptr;
+    }
 };
 
 #endif // ALEEFORTH_MEMDICT_HPP
@@ -30,7 +30,8 @@ static char strbuf[80];
 static void readchar(State& state);
 static void serput(int c);
 static void serputs(const char *s);
-static void printint(DoubleCell n, char *buf, int base);
+static void serwrite(State&, const char *s, std::size_t n);
+static void printint(State& state, DoubleCell n, char *buf, int base);
 
 static Error findword(State&, Word);
 
@@ -74,9 +75,15 @@ LIBALEE_SECTION
 void alee_main()
 {
     (void)alee_dat_len;
-    State state (dict, readchar);
+    Cell dstack[DataStackSize];
+    Cell rstack[ReturnStackSize];
+    State state (dict, readchar, serwrite, dstack, rstack);
     Parser::customParse = findword;
 
+    // The dictionary image ends at `here`, so the heap's metadata in FRAM
+    // is left over from earlier runs.
+    dict.initializeHeap();
+
     serputs("alee forth\n\r");
 
     auto ptr = strbuf;
@@ -90,7 +97,10 @@ void alee_main()
 
                 serputs("\n\r");
 
-                if (auto r = Parser::parse(state, strbuf); r == Error::none) {
+                auto r = Parser::parse(state, strbuf);
+                state.flush();
+
+                if (r == Error::none) {
                     serputs(state.compiling() ? " compiled" : " ok");
                 } else {
                     switch (r) {
@@ -129,6 +139,7 @@ void readchar(State& state)
     if (isupper(c))
         c += 32;
     state.dict.writebyte(addr, c ? c : ' ');
+    state.dict.writebyte(addr + 1, '\0');
 }
 
 LIBALEE_SECTION
@@ -146,7 +157,14 @@ void serputs(const char *s)
 }
 
 LIBALEE_SECTION
-void printint(DoubleCell n, char *buf, int base)
+void serwrite(State&, const char *s, std::size_t n)
+{
+    while (n--)
+        serput(*s++);
+}
+
+LIBALEE_SECTION
+void printint(State& state, DoubleCell n, char *buf, int base)
 {
     static const char digit[] = "0123456789ABCDEF";
 
@@ -161,12 +179,12 @@ void printint(DoubleCell n, char *buf, int base)
     } while ((n /= base));
 
     if (neg)
-        serput('-');
+        state.output('-');
 
     do {
-        serput(*--ptr);
+        state.output(*--ptr);
     } while (ptr > buf);
-    serput(' ');
+    state.output(' ');
 }
 
 LIBALEE_SECTION
@@ -174,13 +192,10 @@ void user_sys(State& state)
 {
     switch (state.pop()) {
     case 0: // .
-        printint(state.pop(), strbuf, state.dict.read(Dictionary::Base));
+        printint(state, state.pop(), strbuf, state.dict.read(Dictionary::Base));
         break;
     case 1: // unused
-        state.push(static_cast<Addr>(state.dict.capacity() - state.dict.here()));
-        break;
-    case 2: // emit
-        serput(state.pop());
+        state.push(static_cast<Cell>(state.dict.heapBottom() - state.dict.here()));
         break;
     case 10:
         { auto index = state.pop() - 20;
@@ -408,9 +423,12 @@ bool alee_isr_handle(unsigned index)
     const Addr isr = isr_list[index];
 
     if (isr != 0) {
-        State isrstate (dict, readchar);
+        Cell dstack[DataStackSize];
+        Cell rstack[ReturnStackSize];
+        State isrstate (dict, readchar, serwrite, dstack, rstack);
         exitLpm = false;
         isrstate.execute(isr);
+        isrstate.flush();
         return exitLpm;
     }
 
@@ -45,6 +45,10 @@ public:
         rodict(rod)
     {
         std::copy(rodict, rodict + sizeof(extra), extra);
+
+        // The image's spare header space cannot be written to.
+        if constexpr (Dictionary::HeaderSpace > 0)
+            write(Dictionary::Names, Dictionary::Begin + Dictionary::HeaderSpace);
     }
 
     constexpr SplitMemDict(const SplitMemDict<RON>& spd):
@@ -96,6 +100,14 @@ public:
     virtual unsigned long int capacity() const noexcept final {
         return RON + sizeof(extra) + sizeof(rwdict);
     }
+
+    LIBALEE_SECTION
+    virtual uint8_t *contiguous(Addr addr, Addr size) noexcept final {
+        if (addr >= RON && addr - RON + size <= sizeof(rwdict))
+            return rwdict + addr - RON;
+        else
+            return nullptr;
+    }
 };
 
 #endif // ALEEFORTH_SPLITMEMDICT_HPP
@@ -0,0 +1,132 @@
+//
+/// @file tracer.hpp
+/// @brief Execution trace capture and display for hosted builds.
+//
+// Alee Forth: A portable and concise Forth implementation in modern C++.
+// Copyright (C) 2023  Clyne Sullivan <clyne@bitgloo.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ALEEFORTH_TRACER_HPP
+#define ALEEFORTH_TRACER_HPP
+
+#include "libalee/alee.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+
+/**
+ * @class Tracer
+ * Owns the ring buffer that State records executed instructions into, and
+ * prints the recorded instructions oldest first with addresses named by
+ * the dictionary entries that contain them.
+ */
+class Tracer
+{
+public:
+    /** Number of instructions kept, the latest ones. */
+    constexpr static std::size_t Size = 256;
+
+    /** Starts or stops tracing the given state. */
+    void enable(State& state, bool on) noexcept {
+        state.trace(on ? entries : nullptr, Size);
+        enabled = on;
+    }
+
+    /** Returns true if tracing is enabled. */
+    bool active() const noexcept {
+        return enabled;
+    }
+
+    /**
+     * Outputs the recorded instructions, then starts recording afresh.
+     * Each line gives the instruction's address, the instruction, and the
+     * depth and top of the data stack before it ran.
+     */
+    void dump(State& state) {
+        const auto count = std::min(state.traced(), Size);
+        const auto first = state.traced() - count;
+
+        for (auto i = first; i < first + count; ++i) {
+            const auto& e = entries[i % Size];
+
+            print(state, e.ip);
+            state.output(' ');
+            symbol(state, e.ip);
+            state.output("  ");
+
+#ifdef ALEE_PACKED
+            if (CoreWords::packed(e.ins)) {
+                token(state, CoreWords::first(e.ins));
+                state.output(' ');
+                token(state, CoreWords::second(e.ins));
+            } else
+#endif // ALEE_PACKED
+            if (static_cast<Addr>(e.ins) >= Dictionary::Begin)
+                symbol(state, static_cast<Addr>(e.ins));
+            else
+                token(state, e.ins);
+
+            state.output("  <");
+            print(state, e.depth);
+            state.output("> ");
+            if (e.depth > 0)
+                print(state, e.top);
+            state.output('\n');
+        }
+
+        if (enabled)
+            enable(state, true);
+    }
+
+private:
+    TraceEntry entries[Size] = {};
+    bool enabled = false;
+
+    static void print(State& state, long n) {
+        char buf[16];
+        const auto end = std::to_chars(buf, buf + sizeof(buf), n).ptr;
+        state.output({buf, static_cast<std::size_t>(end - buf)});
+    }
+
+    /** Outputs a fundamental word's name or a compacted literal's value. */
+    static void token(State& state, Cell ins) {
+        if (ins >= CoreWords::WordCount)
+            print(state, ins - CoreWords::WordCount);
+        else
+            state.output(CoreWords::name(ins));
+    }
+
+    /** Outputs the name of the word containing addr, plus an offset. */
+    static void symbol(State& state, Addr addr) {
+        const Addr entry = addr >= Dictionary::Begin ? state.dict.header(addr) : Addr(0);
+        if (entry == 0) {
+            state.output('?');
+            return;
+        }
+
+        auto word = state.dict.name(entry);
+        for (auto it = word.begin(&state.dict); it != word.end(&state.dict); ++it)
+            state.output(static_cast<char>(*it));
+
+        if (const auto xt = state.dict.getexec(entry); addr != xt) {
+            state.output('+');
+            print(state, addr - xt);
+        }
+    }
+};
+
+#endif // ALEEFORTH_TRACER_HPP
+